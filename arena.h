@@ -0,0 +1,171 @@
+#ifndef TESTSHELL_ARENA_H
+#define TESTSHELL_ARENA_H
+
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define ARENA_ALIGN 16
+#define ARENA_MIN_CHUNK 4096
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * A block of memory handed out piece by piece. Chunks are chained when
+ * a line needs more memory than the current chunk holds.
+ * */
+typedef struct Arena_chunk {
+    struct Arena_chunk*     next;   // previously filled chunk
+    size_t                  size;   // usable bytes in `data`
+    size_t                  used;   // bytes already handed out
+    char                    data[];
+} Arena_chunk;
+
+
+/**
+ * Bump allocator: every allocation is a pointer increment, and everything
+ * is released at once by `arena_reset()`. Nothing is freed individually.
+ * */
+typedef struct Arena {
+    Arena_chunk*    head;           // chunk currently being filled
+    size_t          total;          // usable bytes over all chunks
+    unsigned long   allocations;    // calls to `arena_alloc()`, ever
+    unsigned long   bytes;          // bytes handed out, ever
+    unsigned long   mallocs;        // chunks requested from `malloc()`, ever
+} Arena;
+
+
+/**
+ * Owns every object created while reading, splitting and parsing one
+ * command line. Reset by the main loop once the line has been executed.
+ * */
+Arena LINE_ARENA = {NULL, 0, 0, 0, 0};
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+void* arena_alloc        (Arena* arena, size_t size);
+char* arena_strdup       (Arena* arena, const char* str);
+void  arena_reset        (Arena* arena);
+void  arena_release      (Arena* arena);
+
+
+
+
+/* ********************************************************
+ * ALLOCATION FUNCTIONS
+ * ****************************************************** */
+
+
+/**
+ * Returns `size` bytes aligned on ARENA_ALIGN, or NULL when out of memory.
+ * A new chunk (at least twice as big as the previous total) is only
+ * requested from `malloc()` when the current one is full.
+ * */
+void* arena_alloc (Arena* arena, size_t size){
+    size = (size + ARENA_ALIGN - 1) & ~((size_t) ARENA_ALIGN - 1);
+    arena->allocations++;
+    arena->bytes += size;
+
+    Arena_chunk* chunk = arena->head;
+    if (chunk == NULL || chunk->size - chunk->used < size){
+        size_t chunk_size = arena->total * 2;
+        if (chunk_size < ARENA_MIN_CHUNK) chunk_size = ARENA_MIN_CHUNK;
+        if (chunk_size < size)            chunk_size = size;
+
+        chunk = malloc(sizeof(Arena_chunk) + chunk_size);
+        if (chunk == NULL){
+            return NULL;  // OOM
+        }
+        arena->mallocs++;
+        chunk->next = arena->head;
+        chunk->size = chunk_size;
+        chunk->used = 0;
+        arena->head = chunk;
+        arena->total += chunk_size;
+    }
+
+    void* ptr = chunk->data + chunk->used;
+    chunk->used += size;
+    return ptr;
+}
+
+
+/**
+ * Copies a string inside the arena.
+ * */
+char* arena_strdup (Arena* arena, const char* str){
+    size_t len = strlen(str) + 1;
+    char* copy = arena_alloc(arena, len);
+    if (copy != NULL){
+        memcpy(copy, str, len);
+    }
+    return copy;
+}
+
+
+/**
+ * Invalidates everything that was allocated in the arena. When the last
+ * line needed several chunks, they are merged into a single one big enough
+ * for all of them, so a line of the same size will not touch `malloc()`.
+ * */
+void arena_reset (Arena* arena){
+    Arena_chunk* chunk = arena->head;
+    if (chunk == NULL){
+        return;
+    }
+
+    if (chunk->next != NULL){
+        size_t total = arena->total;
+        arena_release(arena);
+        chunk = malloc(sizeof(Arena_chunk) + total);
+        if (chunk == NULL){
+            return;  // OOM: the next allocation will try again
+        }
+        arena->mallocs++;
+        chunk->next = NULL;
+        chunk->size = total;
+        arena->head = chunk;
+        arena->total = total;
+    }
+
+    chunk->used = 0;
+}
+
+
+/**
+ * Gives every chunk back to the system.
+ * */
+void arena_release (Arena* arena){
+    Arena_chunk* chunk = arena->head;
+    while (chunk != NULL){
+        Arena_chunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    arena->head = NULL;
+    arena->total = 0;
+}
+
+
+#endif //TESTSHELL_ARENA_H
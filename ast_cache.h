@@ -0,0 +1,378 @@
+#ifndef TESTSHELL_AST_CACHE_H
+#define TESTSHELL_AST_CACHE_H
+
+
+#include <stdint.h>
+
+#include "expression.h"
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define AST_CACHE_ENV_VAR "SHELL_AST_CACHE"
+#define AST_CACHE_DEFAULT_LIMIT 64
+#define AST_CACHE_MAX_LIMIT (1 << 20)   // keeps the bucket count in range
+#define FNV_OFFSET 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * A command line that was already parsed. The entry owns its own arena,
+ * which holds the key, the tree, every string the tree points to and the
+ * compiled tree, so it survives the reset of the LINE_ARENA.
+ * */
+typedef struct Ast_entry {
+    uint64_t                hash;
+    char*                   key;        // the words, separated by ' '
+    size_t                  key_len;
+    Expression*             ast;        // immutable: only ever evaluated
+    struct Program*         program;    // compiled `ast`, see "bytecode.h"
+    Arena                   memory;
+    struct Ast_entry*       newer;      // LRU list
+    struct Ast_entry*       older;
+    struct Ast_entry*       next;       // same bucket
+} Ast_entry;
+
+
+/**
+ * Hash table of the last `limit` parsed lines, the least recently used
+ * being evicted first.
+ * */
+typedef struct Ast_cache {
+    Ast_entry**     buckets;
+    size_t          bucket_count;       // power of two, or 0
+    Ast_entry*      newest;
+    Ast_entry*      oldest;
+    size_t          size;
+    size_t          limit;              // 0 disables the cache
+    unsigned long   hits;
+    unsigned long   misses;
+    unsigned long   evictions;
+} Ast_cache;
+
+
+Ast_cache AST_CACHE = {NULL, 0, NULL, NULL, 0, AST_CACHE_DEFAULT_LIMIT,
+                       0, 0, 0};
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+uint64_t     ast_cache_hash     (Split_line* line, int start, int end);
+Expression*  ast_cache_lookup   (Ast_cache* cache, Split_line* line,
+                                 int start, int end, uint64_t hash);
+Expression*  ast_cache_insert   (Ast_cache* cache, Split_line* line,
+                                 int start, int end, uint64_t hash,
+                                 Expression* ast);
+void         ast_cache_evict    (Ast_cache* cache);
+void         ast_cache_set_limit(Ast_cache* cache, size_t limit);
+bool         ast_cache_same_key (Ast_entry* entry, Split_line* line,
+                                 int start, int end);
+
+Expression*  clone_expression   (Arena* arena, const Expression* e);
+Command*     clone_command      (Arena* arena, const Command* cmd);
+
+
+
+
+/* ********************************************************
+ * CACHE FUNCTIONS
+ * ****************************************************** */
+
+
+/**
+ * FNV-1a hash of the words between `start` and `end`, separated by a
+ * single space: lines that only differ by their spacing share an entry.
+ * */
+uint64_t ast_cache_hash (Split_line* line, int start, int end){
+    uint64_t hash = FNV_OFFSET;
+    for (int i = start; i <= end; i++){
+        for (const char* c = line->content[i]; *c != 0; c++){
+            hash = (hash ^ (unsigned char) *c) * FNV_PRIME;
+        }
+        hash = (hash ^ ' ') * FNV_PRIME;
+    }
+    return hash;
+}
+
+
+/**
+ * Compares the key of an entry with the words of a line, without
+ * building the key of the line.
+ * */
+bool ast_cache_same_key (Ast_entry* entry, Split_line* line,
+                         int start, int end){
+    const char* key = entry->key;
+    const char* key_end = entry->key + entry->key_len;
+
+    for (int i = start; i <= end; i++){
+        for (const char* c = line->content[i]; *c != 0; c++){
+            if (key == key_end || *key++ != *c){
+                return false;
+            }
+        }
+        if (key == key_end || *key++ != ' '){
+            return false;
+        }
+    }
+    return key == key_end;
+}
+
+
+/**
+ * Finds the tree of a line that was already parsed, and marks it as the
+ * most recently used.
+ * @return  the cached tree, or NULL on a miss.
+ * */
+Expression* ast_cache_lookup (Ast_cache* cache, Split_line* line,
+                              int start, int end, uint64_t hash){
+    if (cache->limit == 0 || cache->bucket_count == 0){
+        cache->misses++;
+        return NULL;
+    }
+
+    Ast_entry* entry = cache->buckets[hash & (cache->bucket_count - 1)];
+    while (entry != NULL && (entry->hash != hash
+                             || !ast_cache_same_key(entry, line, start, end))){
+        entry = entry->next;
+    }
+
+    if (entry == NULL){
+        cache->misses++;
+        return NULL;
+    }
+    cache->hits++;
+
+    // move to the front of the LRU list
+    if (entry != cache->newest){
+        entry->newer->older = entry->older;
+        if (entry->older != NULL){
+            entry->older->newer = entry->newer;
+        } else {
+            cache->oldest = entry->newer;
+        }
+        entry->newer = NULL;
+        entry->older = cache->newest;
+        cache->newest->newer = entry;
+        cache->newest = entry;
+    }
+    return entry->ast;
+}
+
+
+/**
+ * Copies a freshly parsed tree in a new entry, evicting the least recently
+ * used one when the cache is full.
+ * @return  the copy owned by the cache, or `ast` itself when the cache is
+ *          disabled or out of memory.
+ * */
+Expression* ast_cache_insert (Ast_cache* cache, Split_line* line,
+                              int start, int end, uint64_t hash,
+                              Expression* ast){
+    if (cache->limit == 0){
+        return ast;
+    }
+
+    if (cache->bucket_count == 0){
+        size_t count = 16;
+        while (count < cache->limit * 2) count *= 2;
+        cache->buckets = calloc(count, sizeof(Ast_entry*));
+        if (cache->buckets == NULL){
+            return ast;  // OOM
+        }
+        cache->bucket_count = count;
+    }
+
+    while (cache->size >= cache->limit){
+        ast_cache_evict(cache);
+    }
+
+    Ast_entry* entry = malloc(sizeof(Ast_entry));
+    if (entry == NULL){
+        return ast;  // OOM
+    }
+    entry->memory = (Arena) {NULL, 0, 0, 0, 0};
+    entry->program = NULL;
+
+    size_t key_len = 0;
+    for (int i = start; i <= end; i++){
+        key_len += strlen(line->content[i]) + 1;
+    }
+    entry->key = arena_alloc(&entry->memory, key_len);
+    entry->ast = clone_expression(&entry->memory, ast);
+    if (entry->key == NULL || entry->ast == NULL){
+        arena_release(&entry->memory);
+        free(entry);
+        return ast;  // OOM
+    }
+
+    char* key = entry->key;
+    for (int i = start; i <= end; i++){
+        size_t len = strlen(line->content[i]);
+        memcpy(key, line->content[i], len);
+        key += len;
+        *key++ = ' ';
+    }
+    entry->key_len = key_len;
+    entry->hash = hash;
+
+    size_t bucket = hash & (cache->bucket_count - 1);
+    entry->next = cache->buckets[bucket];
+    cache->buckets[bucket] = entry;
+
+    entry->newer = NULL;
+    entry->older = cache->newest;
+    if (cache->newest != NULL){
+        cache->newest->newer = entry;
+    } else {
+        cache->oldest = entry;
+    }
+    cache->newest = entry;
+    cache->size++;
+
+    return entry->ast;
+}
+
+
+/**
+ * Removes the least recently used entry.
+ * */
+void ast_cache_evict (Ast_cache* cache){
+    Ast_entry* entry = cache->oldest;
+    if (entry == NULL){
+        return;
+    }
+
+    Ast_entry** link = &cache->buckets[entry->hash & (cache->bucket_count-1)];
+    while (*link != entry){
+        link = &(*link)->next;
+    }
+    *link = entry->next;
+
+    cache->oldest = entry->newer;
+    if (cache->oldest != NULL){
+        cache->oldest->older = NULL;
+    } else {
+        cache->newest = NULL;
+    }
+
+    arena_release(&entry->memory);
+    free(entry);
+    cache->size--;
+    cache->evictions++;
+}
+
+
+/**
+ * Changes the maximum number of entries, up to AST_CACHE_MAX_LIMIT. The
+ * buckets are sized again on the next insertion.
+ * */
+void ast_cache_set_limit (Ast_cache* cache, size_t limit){
+    if (limit > AST_CACHE_MAX_LIMIT){
+        limit = AST_CACHE_MAX_LIMIT;
+    }
+    while (cache->size > 0){
+        ast_cache_evict(cache);
+    }
+    free(cache->buckets);
+    cache->buckets = NULL;
+    cache->bucket_count = 0;
+    cache->limit = limit;
+}
+
+
+
+
+/* ********************************************************
+ * COPY FUNCTIONS
+ * ****************************************************** */
+
+
+/**
+ * Deep copy of a tree in `arena`, strings included. The right side of the
+ * '&&'/'||' chains is followed in a loop, so only nested if statements
+ * recurse, like in the parser.
+ * @return  the copy, or NULL when out of memory.
+ * */
+Expression* clone_expression (Arena* arena, const Expression* e){
+    Expression*  root = NULL;
+    Expression** hole = &root;
+
+    while (e != NULL){
+        Expression* copy = arena_alloc(arena, sizeof(Expression));
+        if (copy == NULL){
+            return NULL;
+        }
+        *copy = *e;
+        *hole = copy;
+
+        if (e->id == COMMAND){
+            copy->node.cmd_expr = clone_command(arena, e->node.cmd_expr);
+            return copy->node.cmd_expr == NULL ? NULL : root;
+        }
+
+        copy->node.cond_expr.left = clone_expression(arena,
+                                                     e->node.cond_expr.left);
+        if (copy->node.cond_expr.left == NULL){
+            return NULL;
+        }
+        hole = &copy->node.cond_expr.right;
+        e = e->node.cond_expr.right;
+    }
+    return root;
+}
+
+
+/**
+ * Deep copy of a command in `arena`: the copy owns its strings.
+ * */
+Command* clone_command (Arena* arena, const Command* cmd){
+    Command* copy = arena_alloc(arena, sizeof(Command));
+    if (copy == NULL){
+        return NULL;
+    }
+
+    int argc = 0;
+    while (cmd->cmd[argc] != NULL) argc++;
+
+    copy->cmd = arena_alloc(arena, (argc + 1) * sizeof(char*));
+    if (copy->cmd == NULL){
+        return NULL;
+    }
+    for (int i = 0; i < argc; i++){
+        if ((copy->cmd[i] = arena_strdup(arena, cmd->cmd[i])) == NULL){
+            return NULL;
+        }
+    }
+    copy->cmd[argc] = NULL;
+
+    copy->redirect_flag = cmd->redirect_flag;
+    copy->output_file = NULL;
+    copy->env = NULL;  // only set on the expanded copies
+    if (cmd->redirect_flag){
+        copy->output_file = arena_strdup(arena, cmd->output_file);
+        if (copy->output_file == NULL){
+            return NULL;
+        }
+    }
+    return copy;
+}
+
+
+#endif //TESTSHELL_AST_CACHE_H
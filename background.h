@@ -0,0 +1,466 @@
+#ifndef TESTSHELL_BACKGROUND_H
+#define TESTSHELL_BACKGROUND_H
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define BG_JOBS_MAX 64
+#define BG_STACK_MIN 8
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * An `if`, `&&` or `||` node of a background job whose left side is
+ * running (or has run, when `left_done`).
+ * */
+typedef struct Bg_frame {
+    Expression*     exp;
+    bool            left_done;
+} Bg_frame;
+
+
+/**
+ * A background job. The shell walks its tree itself, one leaf at a time:
+ * a plain command is spawned directly, and only a builtin, a pipeline, a
+ * `time` or a command run in batches (`--xargs`) is run by a forked copy
+ * of the shell. The EVENT_LOOP fills
+ * `status` and `usage` and sets `reaped` when it reaps `pid`.
+ * */
+typedef struct Bg_job {
+    struct Bg_job*      next;       // in BG_FORKED
+    bool                used;       // false for a free slot
+    bool                finished;   // to be reported
+    Expression*         root;       // a copy, owned by `memory`
+    Expression*         leaf;       // the leaf `pid` runs
+    bool                cached;     // `leaf` was found in the PATH_CACHE
+    pid_t               leader;     // the first process, named in reports
+    pid_t               pid;        // the running process, or 0
+    Bg_frame*           stack;      // the path from `root` to `leaf`
+    int                 depth;
+    int                 capacity;
+    Arena               memory;
+    struct timespec     start;
+    struct timespec     end;
+    int                 code;       // exit code, once finished
+    int                 status;     // of `pid`, once reaped
+    struct rusage       usage;      // of every process of the job
+    bool                reaped;
+} Bg_job;
+
+
+/**
+ * The background jobs not reported yet.
+ * */
+Bg_job BG_JOBS[BG_JOBS_MAX];
+
+
+/**
+ * The jobs run as a whole by a forked copy of the shell because the table
+ * was full. The shell only waits for the copy, to report the job.
+ * */
+Bg_job* BG_FORKED = NULL;
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+Bg_job* bg_job_new         (Expression* ast);
+void    bg_job_forked      (pid_t pid);
+void    bg_job_run         (Bg_job* job, Expression* exp);
+bool    bg_job_descend     (Bg_job* job, Expression* exp);
+void    bg_job_step        (Bg_job* job, bool result);
+void    bg_job_finish      (Bg_job* job, bool result);
+bool    bg_job_reaped      (pid_t pid, int status, const struct rusage* usage);
+bool    bg_job_waiting     (const Bg_job* job);
+void    supervise_bg_jobs  ();
+int     wait_bg_jobs       (bool input);
+void    report_bg_jobs     ();
+void    bg_job_print       (const Bg_job* job);
+void    detach_bg_jobs     ();
+
+
+
+
+/* ********************************************************
+ * SUPERVISOR
+ * ****************************************************** */
+
+
+/**
+ * Takes a free slot for a new job and copies its tree there: the line
+ * arena and the AST cache do not keep theirs long enough.
+ * @return  the job, or NULL if the table is full or memory is lacking.
+ * */
+Bg_job* bg_job_new (Expression* ast){
+    for (int i = 0; i < BG_JOBS_MAX; i++){
+        Bg_job* job = &BG_JOBS[i];
+        if (job->used){
+            continue;
+        }
+        memset(job, 0, sizeof(*job));
+        job->root = clone_expression(&job->memory, ast);
+        if (job->root == NULL){
+            arena_release(&job->memory);
+            return NULL;
+        }
+        job->used = true;
+        clock_gettime(CLOCK_MONOTONIC, &job->start);
+        return job;
+    }
+    return NULL;
+}
+
+
+/**
+ * Remembers the copy of the shell that runs a whole job, to report it
+ * like the others. If memory is lacking, the job is simply not reported.
+ * */
+void bg_job_forked (pid_t pid){
+    Bg_job* job = calloc(1, sizeof(Bg_job));
+    if (job == NULL){
+        return;
+    }
+    job->used = true;
+    job->leader = pid;
+    job->pid = pid;
+    clock_gettime(CLOCK_MONOTONIC, &job->start);
+    job->next = BG_FORKED;
+    BG_FORKED = job;
+}
+
+
+/**
+ * Starts the first leaf of `exp` that can run. When none can, the job
+ * goes on as if that leaf had failed.
+ * */
+void bg_job_run (Bg_job* job, Expression* exp){
+    if (!bg_job_descend(job, exp)){
+        bg_job_step(job, false);
+    }
+}
+
+
+/**
+ * Goes down the left sides of `exp`, remembering the way back, and starts
+ * the leaf it ends on without waiting for it. The child ignores Ctrl-Z,
+ * which is meant for the foreground.
+ * @return  false if the leaf could not be started.
+ * */
+bool bg_job_descend (Bg_job* job, Expression* exp){
+    while (exp->id == IF_EXPRESSION || exp->id == AND_EXPRESSION
+                                    || exp->id == OR_EXPRESSION){
+        if (job->depth == job->capacity){
+            int capacity = job->capacity ? job->capacity * 2 : BG_STACK_MIN;
+            Bg_frame* stack = arena_alloc(&job->memory,
+                                          capacity * sizeof(Bg_frame));
+            if (stack == NULL){
+                perror("malloc error bg_job_descend");
+                return false;
+            }
+            if (job->depth > 0){
+                memcpy(stack, job->stack, job->depth * sizeof(Bg_frame));
+            }
+            job->stack = stack;
+            job->capacity = capacity;
+        }
+        job->stack[job->depth].exp = exp;
+        job->stack[job->depth++].left_done = false;
+        exp = exp->node.cond_expr.left;
+    }
+
+    pid_t    pid;
+    Command* cmd = exp->id == COMMAND ? expand_command(exp->node.cmd_expr)
+                                      : NULL;
+    job->leaf = exp;
+    job->reaped = false;
+    remove_Z_handler();  // inherited through the exec
+    remove_C_handlers();
+    if (cmd != NULL && cmd->cmd[0] != NULL
+            && find_builtin(cmd->cmd[0]) == NULL && !xargs_needed(cmd)){
+        pid = start_command(cmd, -1, -1, &job->cached);
+    } else {
+        job->cached = false;
+        pid = start_stage(exp, -1, -1, -1);
+    }
+    restore_C_handlers();
+    restore_Z_handler();
+
+    if (pid <= 0){
+        return false;
+    }
+    job->pid = pid;
+    if (job->leader == 0){
+        job->leader = pid;
+    }
+    return true;
+}
+
+
+/**
+ * Goes on with a job whose leaf ended with `result`: climbs back up the
+ * tree until an `if`, `&&` or `||` has a right side to run, exactly like
+ * `eval()` would.
+ * */
+void bg_job_step (Bg_job* job, bool result){
+    while (job->depth > 0){
+        Bg_frame*   frame = &job->stack[job->depth - 1];
+        Expression* right = frame->exp->node.cond_expr.right;
+        Expression* next = NULL;
+
+        if (!frame->left_done){
+            frame->left_done = true;
+            switch (frame->exp->id){
+                case AND_EXPRESSION:  next = result ? right : NULL;  break;
+                case OR_EXPRESSION:   next = result ? NULL : right;  break;
+                case IF_EXPRESSION:
+                    next = result ? right : NULL;
+                    result = true;  // a false condition is a success
+                    break;
+                default:              break;
+            }
+        }
+
+        if (next == NULL){
+            job->depth--;  // this node is done, with `result`
+        } else if (bg_job_descend(job, next)){
+            return;
+        } else {
+            result = false;
+        }
+    }
+    bg_job_finish(job, result);
+}
+
+
+/**
+ * Marks a job as ready to be reported. A job of one external command
+ * reports the exit code of that command.
+ * */
+void bg_job_finish (Bg_job* job, bool result){
+    clock_gettime(CLOCK_MONOTONIC, &job->end);
+    if (job->root->id == COMMAND && job->leader != 0
+            && WEXITSTATUS(job->status) != FAILED_EXECVP){
+        job->code = WIFEXITED(job->status) ? WEXITSTATUS(job->status)
+                                           : 128 + WTERMSIG(job->status);
+    } else {
+        job->code = result ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    job->finished = true;
+    SHELL_STATS.bg_reaped++;
+
+    trace_span("background", (double) job->start.tv_sec * 1e6
+                             + (double) job->start.tv_nsec / 1e3,
+               job->root->id == COMMAND ? job->root->node.cmd_expr->cmd
+                                        : NULL, job->leader);
+    arena_release(&job->memory);
+    job->root = NULL;
+    job->leaf = NULL;
+    job->stack = NULL;
+}
+
+
+/**
+ * Called by `child_reaped()` for every child the EVENT_LOOP reaps.
+ * @return  true if the child was running for a background job.
+ * */
+bool bg_job_reaped (pid_t pid, int status, const struct rusage* usage){
+    for (int i = 0; i < BG_JOBS_MAX; i++){
+        Bg_job* job = &BG_JOBS[i];
+        if (job->used && job->pid == pid && !job->reaped){
+            job->status = status;
+            add_usage(&job->usage, usage);
+            job->reaped = true;
+            return true;
+        }
+    }
+    for (Bg_job* job = BG_FORKED; job != NULL; job = job->next){
+        if (job->pid == pid && !job->reaped){
+            job->status = status;
+            add_usage(&job->usage, usage);
+            job->reaped = true;
+            job->finished = true;  // the copy ran all of it
+            job->code = WIFEXITED(status) ? WEXITSTATUS(status)
+                                          : 128 + WTERMSIG(status);
+            clock_gettime(CLOCK_MONOTONIC, &job->end);
+            SHELL_STATS.bg_reaped++;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * @return  true if something has to run once the current process of
+ *          the job ends, so the shell must not leave it behind.
+ * */
+bool bg_job_waiting (const Bg_job* job){
+    return job->used && !job->finished && job->pid != 0 && job->depth > 0;
+}
+
+
+/**
+ * Moves every job whose current process was reaped to its next leaf. A
+ * forked copy of the shell leaves the jobs to the shell.
+ * */
+void supervise_bg_jobs (){
+    if (SUBSHELL){
+        return;
+    }
+    for (int i = 0; i < BG_JOBS_MAX; i++){
+        Bg_job* job = &BG_JOBS[i];
+        if (!job->used || job->finished || job->pid == 0 || !job->reaped){
+            continue;
+        }
+        bool result;
+        if (job->leaf->id == COMMAND
+                && find_builtin(job->leaf->node.cmd_expr->cmd[0]) == NULL){
+            result = command_status(job->leaf->node.cmd_expr, job->status,
+                                    job->cached);
+        } else {
+            result = job->status == 0;
+        }
+        job->pid = 0;
+        bg_job_step(job, result);
+    }
+}
+
+
+/**
+ * Keeps the jobs going while the shell has nothing else to do: until the
+ * standard input can be read when `input`, else until none of them has
+ * anything left to run. Sleeps in the EVENT_LOOP.
+ * @return  EVENT_INPUT when the input can be read, EVENT_CHILD when a job
+ *          ended and is to be reported first, EVENT_INTERRUPT after a
+ *          Ctrl-C, 0 when no job is left to wait for.
+ * */
+int wait_bg_jobs (bool input){
+    while (true){
+        supervise_bg_jobs();
+
+        bool waiting = false;
+        bool finished = false;
+        for (int i = 0; i < BG_JOBS_MAX; i++){
+            waiting = waiting || bg_job_waiting(&BG_JOBS[i]);
+            finished = finished || (BG_JOBS[i].used && BG_JOBS[i].finished);
+        }
+        for (Bg_job* job = BG_FORKED; job != NULL; job = job->next){
+            finished = finished || job->finished;
+        }
+        if (input && finished){
+            return EVENT_CHILD;
+        }
+        if (!input && !waiting){
+            return 0;
+        }
+
+        int events = event_loop_wait(&EVENT_LOOP, input);
+        if (events < 0){
+            return input ? EVENT_INPUT : 0;  // the read will tell
+        }
+        if (events & EVENT_INTERRUPT){
+            return EVENT_INTERRUPT;
+        }
+        if (events & EVENT_INPUT){
+            return EVENT_INPUT;
+        }
+    }
+}
+
+
+/**
+ * Prints one line for every background job that ended since the last
+ * call, and frees its slot.
+ * */
+void report_bg_jobs (){
+    supervise_bg_jobs();
+    for (int i = 0; i < BG_JOBS_MAX; i++){
+        Bg_job* job = &BG_JOBS[i];
+        if (!job->used || !job->finished){
+            continue;
+        }
+        if (job->leader != 0){  // else it never started: already reported
+            bg_job_print(job);
+        }
+        job->used = false;
+    }
+    for (Bg_job** link = &BG_FORKED; *link != NULL; ){
+        Bg_job* job = *link;
+        if (!job->finished){
+            link = &job->next;
+            continue;
+        }
+        bg_job_print(job);
+        *link = job->next;
+        free(job);
+    }
+}
+
+
+/**
+ * Prints the line of a job that ended.
+ * */
+void bg_job_print (const Bg_job* job){
+    fprintf(stderr, "[%d] done (status %d)  real %.3fs  user %.3fs  "
+                    "sys %.3fs  maxrss %ld KiB  ctxsw %ld/%ld\n",
+            job->leader, job->code, seconds_between(&job->start, &job->end),
+            tv_seconds(&job->usage.ru_utime),
+            tv_seconds(&job->usage.ru_stime), job->usage.ru_maxrss,
+            job->usage.ru_nvcsw, job->usage.ru_nivcsw);
+}
+
+
+/**
+ * Lets an interactive shell exit without waiting for the jobs (a script
+ * waits for their chains first, see `wait_bg_jobs()`). Their processes go
+ * on alone, and so do the forked copies, which run their whole chain.
+ * Only the shell can wait for the other processes, though: nothing can
+ * run what their chain had left once they end, so that part is dropped,
+ * and said so.
+ * */
+void detach_bg_jobs (){
+    supervise_bg_jobs();
+    for (int i = 0; i < BG_JOBS_MAX; i++){
+        Bg_job* job = &BG_JOBS[i];
+        if (bg_job_waiting(job)){
+            fprintf(stderr, "[%d] left running, without the rest of its "
+                            "chain\n", job->leader);
+        }
+        if (job->used && !job->finished){
+            arena_release(&job->memory);
+        }
+        job->used = false;
+    }
+    while (BG_FORKED != NULL){
+        Bg_job* job = BG_FORKED;
+        BG_FORKED = job->next;
+        free(job);
+    }
+}
+
+
+#endif //TESTSHELL_BACKGROUND_H
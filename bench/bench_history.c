@@ -0,0 +1,203 @@
+/* bench_history.c
+ *
+ * Cost of the persistent history as it grows: a log of generated command
+ * lines is indexed from scratch (what happens after a crash), then opened
+ * again, which must not depend on its size. The first search builds the
+ * trigram index; the following ones are timed for substrings that are
+ * found, lines that are not there but share most of their trigrams with
+ * the others, `!prefix` recalls and one-letter searches (which scan).
+ * Appending a line is timed last.
+ *
+ * usage: bench_history [ENTRIES]
+ */
+
+
+#define SHELL_NO_MAIN
+#include "../main.c"
+
+#include <time.h>
+
+
+#define BENCH_DEFAULT_ENTRIES 1000000
+#define BENCH_QUERIES 2000
+#define BENCH_APPENDS 1000
+
+
+static const char * benchTemplates[] = {
+    "make -j%d target%d",
+    "ssh build%d.example.com uptime %d",
+    "grep -rn pattern%d src/module%d",
+    "./run_job --input=data/%d.csv --workers=%d",
+    "tail -n %d /var/log/app%d.log",
+    "python3 train.py --epochs %d --seed %d",
+    "docker run --rm -e ID=%d image:%d",
+    "echo %d >> notes%d.txt",
+};
+
+
+double now_ns() {
+    /// Monotonic clock, in nanoseconds.
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+int compare_doubles(const void* a, const void* b) {
+    double x = *(const double*) a;
+    double y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+
+void print_latencies(const char* name, double* ns, int count, int found) {
+    /// One line of results: the percentiles of `count` timings.
+
+    qsort(ns, (size_t) count, sizeof(double), compare_doubles);
+    printf("%-22s %8d %8d %10.2f %10.2f %10.2f\n", name, count, found,
+           ns[count / 2] / 1e3, ns[count * 99 / 100] / 1e3,
+           ns[count - 1] / 1e3);
+    fflush(stdout);
+}
+
+size_t write_log(const char* path, long entries) {
+    /// Writes `entries` generated lines, without any index.
+
+    FILE* log = fopen(path, "w");
+    if (log == NULL) {
+        return 0;
+    }
+    size_t templates = sizeof(benchTemplates) / sizeof(benchTemplates[0]);
+    for (long i = 0; i < entries; i++) {
+        fprintf(log, benchTemplates[rand() % templates], rand() % 100000,
+                rand() % 1000);
+        fputc('\n', log);
+    }
+    long size = ftell(log);
+    fclose(log);
+    return (size_t) size;
+}
+
+size_t gram_index_bytes(const Gram_index* index) {
+    /// Memory held by the trigram index.
+
+    size_t bytes = index->capacity * sizeof(Posting);
+    for (size_t i = 0; i < index->capacity; i++) {
+        bytes += index->slots[i].capacity * sizeof(uint32_t);
+    }
+    return bytes;
+}
+
+int bench_search(const char* name, int kind, double* ns) {
+    /// Times BENCH_QUERIES searches of one kind: 0 a slice of an entry,
+    /// 1 a line made of two halves of entries, 2 the start of an entry as a
+    /// prefix, 3 a single letter. Returns how many were found.
+
+    int found = 0;
+    for (int q = 0; q < BENCH_QUERIES; q++) {
+        size_t len;
+        const char* entry = history_entry(&HISTORY, rand() % HISTORY.count,
+                                          &len);
+        char text[128];
+        size_t text_len;
+        if (kind == 1) {
+            size_t other_len;
+            const char* other = history_entry(&HISTORY,
+                                              rand() % HISTORY.count,
+                                              &other_len);
+            text_len = (size_t) snprintf(text, sizeof(text), "%.*s%.*s",
+                                         (int) (len / 2), entry,
+                                         (int) (other_len - other_len / 2),
+                                         other + other_len / 2);
+        } else {
+            size_t want = kind == 3 ? 1 : 8;
+            size_t start = kind == 0 && len > want
+                           ? (size_t) rand() % (len - want) : 0;
+            text_len = len < want ? len : want;
+            memcpy(text, entry + start, text_len);
+        }
+
+        double t0 = now_ns();
+        size_t match = history_search(&HISTORY, text, text_len, kind == 2,
+                                      HISTORY.count);
+        ns[q] = now_ns() - t0;
+        found += match != HISTORY_NOT_FOUND;
+    }
+    print_latencies(name, ns, BENCH_QUERIES, found);
+    return found;
+}
+
+int main(int argc, char** argv) {
+    /// Builds a history of ENTRIES lines in /tmp and measures it.
+
+    long entries = argc > 1 ? strtol(argv[1], NULL, 10)
+                            : BENCH_DEFAULT_ENTRIES;
+    if (entries < 1) {
+        fprintf(stderr, "usage: %s [ENTRIES]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    char path[] = "/tmp/bench_history.XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        perror("mkstemp");
+        return EXIT_FAILURE;
+    }
+    close(fd);
+    char index_path[sizeof(path) + sizeof(HISTORY_INDEX_SUFFIX)];
+    sprintf(index_path, "%s%s", path, HISTORY_INDEX_SUFFIX);
+
+    srand(1);
+    size_t bytes = write_log(path, entries);
+    printf("%ld entries, %.1f MB of log\n\n", entries, bytes / 1e6);
+
+    /* Opening: from the log alone, then with the index. */
+    double t0 = now_ns();
+    bool ok = history_open(&HISTORY, path);
+    double t1 = now_ns();
+    history_close(&HISTORY);
+    double t2 = now_ns();
+    ok = ok && history_open(&HISTORY, path);
+    double t3 = now_ns();
+    if (!ok || HISTORY.count != (size_t) entries) {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    printf("open without index     %10.3f ms\n", (t1 - t0) / 1e6);
+    printf("open                   %10.3f ms\n", (t3 - t2) / 1e6);
+
+    /* The first search pays for the trigram index. */
+    t0 = now_ns();
+    history_search(&HISTORY, "make", 4, false, HISTORY.count);
+    t1 = now_ns();
+    printf("trigram index          %10.3f ms, %zu trigrams, %.1f MB\n\n",
+           (t1 - t0) / 1e6, HISTORY.grams.used,
+           gram_index_bytes(&HISTORY.grams) / 1e6);
+
+    double* ns = malloc(BENCH_QUERIES * sizeof(double));
+    if (ns == NULL) {
+        perror("malloc error bench_history");
+        return EXIT_FAILURE;
+    }
+    printf("%-22s %8s %8s %10s %10s %10s\n", "us", "count", "found",
+           "p50", "p99", "max");
+    bench_search("substring (found)", 0, ns);
+    bench_search("two halves (missing)", 1, ns);
+    bench_search("!prefix", 2, ns);
+    bench_search("one letter (scan)", 3, ns);
+
+    for (int a = 0; a < BENCH_APPENDS; a++) {
+        char line[64];
+        int len = snprintf(line, sizeof(line), "echo appended %d", a);
+        t0 = now_ns();
+        history_add(&HISTORY, line, (size_t) len);
+        ns[a] = now_ns() - t0;
+    }
+    print_latencies("append", ns, BENCH_APPENDS, BENCH_APPENDS);
+
+    free(ns);
+    history_close(&HISTORY);
+    unlink(path);
+    unlink(index_path);
+    arena_release(&LINE_ARENA);
+    return EXIT_SUCCESS;
+}
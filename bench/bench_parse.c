@@ -0,0 +1,189 @@
+/* bench_parse.c
+ *
+ * Scaling of the front-end of the shell on generated command lines: long
+ * '&&'/'||' chains, deeply nested if statements, commands with many
+ * redirections and very long argument lists, from 10 to 1,000,000 words.
+ * Tokenizing (`split_str()`), parsing (`parse_line()`, which calls
+ * `create_cmd()`) and the teardown of the tree (`arena_reset()`) are timed
+ * separately. Nothing is executed, and the AST cache is not involved.
+ *
+ * usage: bench_parse [MAX_TOKENS]
+ */
+
+
+#define SHELL_NO_MAIN
+#include "../main.c"
+
+#include <time.h>
+
+
+#define BENCH_MIN_TOKENS 10
+#define BENCH_MAX_TOKENS 1000000
+#define BENCH_TOKENS_PER_SIZE 2000000   // repeat small lines until this many
+
+
+/*
+ * One kind of generated line. `build` writes a line of about `tokens`
+ * words in `out` (which is big enough) and returns its length.
+ */
+typedef struct Shape {
+    const char*     name;
+    size_t          (*build)(char* out, long tokens);
+} Shape;
+
+
+size_t build_chain(char* out, long tokens) {
+    /// `true && true || true && ...`
+
+    size_t len = (size_t) sprintf(out, "true");
+    for (long t = 1; t + 2 <= tokens; t += 2) {
+        len += (size_t) sprintf(out + len, (t / 2) % 2 ? " || true"
+                                                       : " && true");
+    }
+    return len;
+}
+
+size_t build_nested_if(char* out, long tokens) {
+    /// `if true ; do if true ; do ... true ; done ... ; done`, as deep as
+    /// the parser allows; longer lines chain such blocks with `&&`.
+
+    long   nests = (tokens - 1) / 6;
+    size_t len = 0;
+    while (true) {
+        long depth = nests < PARSE_MAX_DEPTH ? nests : PARSE_MAX_DEPTH;
+        for (long d = 0; d < depth; d++) {
+            memcpy(out + len, "if true ; do ", 13);
+            len += 13;
+        }
+        memcpy(out + len, "true", 4);
+        len += 4;
+        for (long d = 0; d < depth; d++) {
+            memcpy(out + len, " ; done", 7);
+            len += 7;
+        }
+        nests -= depth;
+        if (nests <= 0) break;
+        memcpy(out + len, " && ", 4);
+        len += 4;
+    }
+    out[len] = 0;
+    return len;
+}
+
+size_t build_redirects(char* out, long tokens) {
+    /// `echo x > f > f > ...`
+
+    size_t len = (size_t) sprintf(out, "echo x");
+    for (long t = 2; t + 2 <= tokens; t += 2) {
+        memcpy(out + len, " > f", 4);
+        len += 4;
+    }
+    out[len] = 0;
+    return len;
+}
+
+size_t build_arguments(char* out, long tokens) {
+    /// `echo a1 a2 a3 ...`
+
+    size_t len = (size_t) sprintf(out, "echo");
+    for (long t = 1; t < tokens; t++) {
+        len += (size_t) sprintf(out + len, " a%ld", t);
+    }
+    return len;
+}
+
+static const Shape benchShapes[] = {
+    {"chain",       build_chain},
+    {"nested-if",   build_nested_if},
+    {"redirects",   build_redirects},
+    {"arguments",   build_arguments},
+};
+
+
+double now_ns() {
+    /// Monotonic clock, in nanoseconds.
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+void bench_shape(const Shape* shape, long tokens, char* text, char* work) {
+    /// Splits, parses and frees the same line until enough words were seen,
+    /// and prints one line of results.
+
+    size_t len = shape->build(text, tokens);
+    long reps = BENCH_TOKENS_PER_SIZE / tokens;
+    if (reps < 1) reps = 1;
+
+    double split_ns = 0, parse_ns = 0, reset_ns = 0;
+    long words = 0;
+    unsigned long allocations = LINE_ARENA.allocations;
+    unsigned long mallocs = LINE_ARENA.mallocs;
+
+    for (long r = 0; r < reps; r++) {
+        memcpy(work, text, len + 1);  // `split_str()` works in place
+
+        double t0 = now_ns();
+        Split_line* line = split_str(work, len, " ");
+        double t1 = now_ns();
+        Expression* ast = line ? parse_line(line, 0, line->size - 1) : NULL;
+        double t2 = now_ns();
+        int size = ast ? line->size : 0;  // the line goes with the reset
+        arena_reset(&LINE_ARENA);
+        double t3 = now_ns();
+
+        if (ast == NULL) {
+            fprintf(stderr, "%s: no tree for %ld words\n", shape->name, tokens);
+            return;
+        }
+        words += size;
+        split_ns += t1 - t0;
+        parse_ns += t2 - t1;
+        reset_ns += t3 - t2;
+    }
+
+    printf("%-10s %9ld %8ld %10.2f %10.2f %10.2f %12.1f %10.3f\n",
+           shape->name, words / reps, reps, split_ns / words,
+           parse_ns / words, reset_ns / words,
+           (double) (LINE_ARENA.allocations - allocations) / reps,
+           (double) (LINE_ARENA.mallocs - mallocs) / reps);
+    fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+    /// Sweeps every shape from BENCH_MIN_TOKENS to MAX_TOKENS words.
+
+    long max_tokens = argc > 1 ? strtol(argv[1], NULL, 10) : BENCH_MAX_TOKENS;
+    if (max_tokens < BENCH_MIN_TOKENS) {
+        fprintf(stderr, "usage: %s [MAX_TOKENS]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /* The longest word of a line is 8 bytes with its space. */
+    char* text = malloc((size_t) max_tokens * 8 + 64);
+    char* work = malloc((size_t) max_tokens * 8 + 64);
+    if (text == NULL || work == NULL) {
+        perror("malloc error bench_parse");
+        return EXIT_FAILURE;
+    }
+
+    printf("%-10s %9s %8s %10s %10s %10s %12s %10s\n", "shape", "tokens",
+           "reps", "split ns", "parse ns", "reset ns", "allocs/line",
+           "mallocs");
+    printf("%-10s %9s %8s %10s %10s %10s %12s %10s\n", "", "", "",
+           "/token", "/token", "/token", "", "/line");
+
+    size_t shapes = sizeof(benchShapes) / sizeof(benchShapes[0]);
+    for (size_t s = 0; s < shapes; s++) {
+        for (long tokens = BENCH_MIN_TOKENS; tokens <= max_tokens;
+                                             tokens *= 10) {
+            bench_shape(&benchShapes[s], tokens, text, work);
+        }
+    }
+
+    free(text);
+    free(work);
+    arena_release(&LINE_ARENA);
+    return EXIT_SUCCESS;
+}
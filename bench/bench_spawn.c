@@ -0,0 +1,216 @@
+/* bench_spawn.c
+ *
+ * Process-spawn throughput of the shell: runs trivial commands through the
+ * real `eval()` / `run_command()` path with every spawn engine, and reports
+ * the commands per second with the median and 99th percentile latency.
+ * The shell is then made bigger (a heap of 100 MB, then 1 GB, all touched)
+ * to show how the cost of each engine grows with the size of the parent;
+ * the fork server is started before, while the process is still small.
+ * Finally, the same commands are run as scripts by `/bin/sh` and `dash`.
+ *
+ * usage: bench_spawn [-n COUNT] [--rss=MB,MB,...]
+ */
+
+
+#define SHELL_NO_MAIN
+#include "../main.c"
+
+#include <time.h>
+#include <spawn.h>
+
+
+#define BENCH_DEFAULT_COUNT 2000
+#define BENCH_DEFAULT_RSS "0,100,1024"
+#define BENCH_WARM_UP 20
+#define BENCH_USAGE "usage: %s [-n COUNT] [--rss=MB,MB,...]\n"
+
+
+static const char * benchCommands[] = {
+    "true",                         // builtin: no process at all
+    "/bin/true",
+    "echo x > /dev/null",           // builtin with a redirection
+    "/bin/echo x > /dev/null",
+};
+
+static const char * benchShells[] = {"sh", "dash"};
+
+
+double now_ns() {
+    /// Monotonic clock, in nanoseconds.
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+int compare_doubles(const void* a, const void* b) {
+    double x = *(const double*) a;
+    double y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+
+Expression* parse_bench_command(const char* command) {
+    /// Parses a command once, like the shell does. The tree is owned by the
+    /// AST_CACHE, so it survives the reset of the LINE_ARENA.
+
+    char* copy = arena_strdup(&LINE_ARENA, command);
+    Split_line* line = copy ? split_str(copy, strlen(copy), " ") : NULL;
+    Expression* ast = line ? get_ast(line, line->size - 1) : NULL;
+    arena_reset(&LINE_ARENA);
+    return ast;
+}
+
+void bench_eval(const char* command, long count, double* latencies) {
+    /// Evaluates a command `count` times and prints one line of results.
+
+    Expression* ast = parse_bench_command(command);
+    if (ast == NULL) {
+        fprintf(stderr, "cannot parse: %s\n", command);
+        return;
+    }
+
+    for (int i = 0; i < BENCH_WARM_UP; i++) {
+        eval(ast);
+    }
+
+    double start = now_ns();
+    for (long i = 0; i < count; i++) {
+        double before = now_ns();
+        eval(ast);
+        latencies[i] = now_ns() - before;
+    }
+    double total = now_ns() - start;
+
+    qsort(latencies, (size_t) count, sizeof(double), compare_doubles);
+    printf("%-12s %-26s %12.0f %10.1f %10.1f\n",
+           spawnModeStrings[SPAWN_MODE], command, count / (total / 1e9),
+           latencies[count / 2] / 1e3, latencies[count * 99 / 100] / 1e3);
+    fflush(stdout);
+}
+
+double bench_script(const char* shell, const char* script, long count) {
+    /// Runs `shell script` and returns the commands per second, or -1.
+    /// The shell must not inherit the signals our EVENT_LOOP blocks.
+
+    char* args[] = {(char*) shell, (char*) script, NULL};
+    sigset_t none;
+    posix_spawnattr_t attr;
+    sigemptyset(&none);
+    posix_spawnattr_init(&attr);
+    posix_spawnattr_setsigmask(&attr, &none);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK);
+
+    int status = -1;
+    pid_t pid;
+    double start = now_ns();
+    if (posix_spawn(&pid, shell, NULL, &attr, args, environ) == 0) {
+        waitpid(pid, &status, 0);
+    }
+    double total = now_ns() - start;
+
+    posix_spawnattr_destroy(&attr);
+    return status == 0 ? count / (total / 1e9) : -1;
+}
+
+void bench_shells(long count) {
+    /// Runs every command `count` times as a script of the other shells.
+
+    printf("\n%-12s %-26s %12s\n", "shell", "command", "cmds/s");
+
+    size_t commands = sizeof(benchCommands) / sizeof(benchCommands[0]);
+    size_t shells = sizeof(benchShells) / sizeof(benchShells[0]);
+    for (size_t c = 0; c < commands; c++) {
+        char script[] = "/tmp/bench_spawn_XXXXXX";
+        int fd = mkstemp(script);
+        FILE* file = fd < 0 ? NULL : fdopen(fd, "w");
+        if (file == NULL) {
+            perror("bench script");
+            return;
+        }
+        for (long i = 0; i < count; i++) {
+            fprintf(file, "%s\n", benchCommands[c]);
+        }
+        fclose(file);
+
+        for (size_t s = 0; s < shells; s++) {
+            char path[PATH_MAX];
+            if (!search_path(benchShells[s], path, sizeof(path))) {
+                printf("%-12s %-26s %12s\n", benchShells[s],
+                       benchCommands[c], "not found");
+                continue;
+            }
+            printf("%-12s %-26s %12.0f\n", benchShells[s], benchCommands[c],
+                   bench_script(path, script, count));
+        }
+        unlink(script);
+    }
+}
+
+int main(int argc, char** argv) {
+    /// Runs every command with every engine, for every size of the shell.
+
+    long count = BENCH_DEFAULT_COUNT;
+    const char* rss_list = BENCH_DEFAULT_RSS;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            count = strtol(argv[++i], NULL, 10);
+        } else if (strncmp(argv[i], "--rss=", 6) == 0) {
+            rss_list = argv[i] + 6;
+        } else {
+            fprintf(stderr, BENCH_USAGE, argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (count <= 0) {
+        fprintf(stderr, BENCH_USAGE, argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    INTERACTIVE = false;
+    if (!fork_server_start()) {
+        perror("fork server");  // its rows then measure posix_spawn
+    }
+    set_up_signals();
+
+    double* latencies = malloc(count * sizeof(double));
+    if (latencies == NULL) {
+        perror("malloc error latencies");
+        return EXIT_FAILURE;
+    }
+
+    size_t commands = sizeof(benchCommands) / sizeof(benchCommands[0]);
+    for (const char* rss = rss_list; *rss != 0; ) {
+        char* end;
+        long mb = strtol(rss, &end, 10);
+
+        /* The ballast is touched so that every page is really mapped. */
+        char* ballast = mb > 0 ? malloc((size_t) mb << 20) : NULL;
+        if (ballast != NULL) {
+            memset(ballast, 1, (size_t) mb << 20);
+        } else if (mb > 0) {
+            fprintf(stderr, "cannot allocate %ld MB\n", mb);
+        }
+
+        printf("\nextra heap: %ld MB\n", ballast != NULL ? mb : 0);
+        printf("%-12s %-26s %12s %10s %10s\n",
+               "engine", "command", "cmds/s", "p50 us", "p99 us");
+        for (int mode = SPAWN_FORK; mode <= SPAWN_SERVER; mode++) {
+            SPAWN_MODE = (spawn_mode) mode;
+            for (size_t c = 0; c < commands; c++) {
+                bench_eval(benchCommands[c], count, latencies);
+            }
+        }
+
+        free(ballast);
+        rss = (*end == ',') ? end + 1 : end;
+        if (end == rss && *rss != 0) {
+            break;  // not a number
+        }
+    }
+
+    bench_shells(count);
+
+    free(latencies);
+    fork_server_stop();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,244 @@
+#ifndef TESTSHELL_BUILTINS_H
+#define TESTSHELL_BUILTINS_H
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <limits.h>
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define TRUE_BUILTIN "true"
+#define FALSE_BUILTIN "false"
+#define CD_BUILTIN "cd"
+#define PWD_BUILTIN "pwd"
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * A command run by the shell itself, without any child process. Like
+ * `run_command()`, it returns true on success.
+ * */
+typedef struct Builtin {
+    const char*     name;
+    int             (*run)(Command* cmd);
+} Builtin;
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+const Builtin* find_builtin (const char* name);
+int            run_builtin  (const Builtin* builtin, Command* cmd);
+
+int true_builtin            (Command* cmd);
+int false_builtin           (Command* cmd);
+int echo_builtin            (Command* cmd);
+int cd_builtin              (Command* cmd);
+int pwd_builtin             (Command* cmd);
+int exit_builtin            (Command* cmd);
+
+
+/**
+ * Every builtin, looked up by `run_command()` before anything is spawned.
+ * */
+static const Builtin builtinTable[] = {
+    {TRUE_BUILTIN,      true_builtin},
+    {FALSE_BUILTIN,     false_builtin},
+    {ECHO,              echo_builtin},
+    {CD_BUILTIN,        cd_builtin},
+    {PWD_BUILTIN,       pwd_builtin},
+    {EXIT_SHELL,        exit_builtin},
+    {HASH_BUILTIN,      hash_builtin},
+    {PARALLEL_BUILTIN,  parallel_builtin},
+    {SHELLSTAT_BUILTIN, shellstat_builtin},
+    {HISTORY_BUILTIN,   history_builtin},
+    {EXPORT_BUILTIN,    export_builtin},
+    {UNSET_BUILTIN,     unset_builtin},
+};
+
+
+
+
+/* ********************************************************
+ * DISPATCH FUNCTIONS
+ * ****************************************************** */
+
+
+/**
+ * @return  the builtin called `name`, or NULL if it is an external command.
+ * */
+const Builtin* find_builtin (const char* name){
+    size_t count = sizeof(builtinTable) / sizeof(builtinTable[0]);
+    for (size_t b = 0; b < count; b++){
+        if (builtinTable[b].name[0] == name[0]
+                && strcmp(builtinTable[b].name, name) == 0){
+            return &builtinTable[b];
+        }
+    }
+    return NULL;
+}
+
+
+/**
+ * Runs a builtin in the shell process. A '>' is honoured by pointing the
+ * standard output of the shell to the file for the duration of the
+ * builtin, and back to where it was afterwards.
+ * */
+int run_builtin (const Builtin* builtin, Command* cmd){
+    int saved = -1;
+
+    if (cmd->redirect_flag){
+        fflush(stdout);
+        saved = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, 0);
+        if (saved < 0 || !writeOutputInFile(cmd->output_file)){
+            perror(cmd->output_file);
+            if (saved >= 0) close(saved);
+            return false;
+        }
+    }
+
+    int result = builtin->run(cmd);
+
+    if (saved >= 0){
+        fflush(stdout);
+        dup2(saved, STDOUT_FILENO);
+        close(saved);
+    }
+    return result;
+}
+
+
+
+
+/* ********************************************************
+ * BUILTINS
+ * ****************************************************** */
+
+
+int true_builtin (Command* cmd){
+    (void) cmd;
+    return true;
+}
+
+
+int false_builtin (Command* cmd){
+    (void) cmd;
+    return false;
+}
+
+
+/**
+ * `echo [-n] word...` prints the words separated by a space, and a '\n'
+ * unless `-n` is given.
+ * */
+int echo_builtin (Command* cmd){
+    char** args = cmd->cmd + 1;
+    bool   newline = true;
+
+    if (args[0] != NULL && strcmp(args[0], "-n") == 0){
+        newline = false;
+        args++;
+    }
+    for (int i = 0; args[i] != NULL; i++){
+        if (i > 0) putchar(' ');
+        fputs(args[i], stdout);
+    }
+    if (newline) putchar('\n');
+    return true;
+}
+
+
+/**
+ * `cd [dir]` changes the current directory, $HOME by default, and keeps
+ * $PWD and $OLDPWD up to date.
+ * */
+int cd_builtin (Command* cmd){
+    const char* dir = cmd->cmd[1];
+    if (dir == NULL){
+        dir = var_get(&VARS, "HOME");
+        if (dir == NULL){
+            fprintf(stderr, "cd: HOME not set\n");
+            return false;
+        }
+    }
+
+    if (chdir(dir) < 0){
+        fprintf(stderr, "cd: %s: %s\n", dir, strerror(errno));
+        return false;
+    }
+
+    const char* old = var_get(&VARS, "PWD");
+    if (old != NULL){
+        var_set(&VARS, "OLDPWD", 6, old, true);
+    }
+    char cwd[PATH_MAX];
+    if (getcwd(cwd, sizeof(cwd)) != NULL){
+        var_set(&VARS, "PWD", 3, cwd, true);
+    }
+
+    path_cache_changed_dir(&PATH_CACHE);
+    return true;
+}
+
+
+/**
+ * `pwd` prints the current directory.
+ * */
+int pwd_builtin (Command* cmd){
+    (void) cmd;
+    char cwd[PATH_MAX];
+    if (getcwd(cwd, sizeof(cwd)) == NULL){
+        perror(PWD_BUILTIN);
+        return false;
+    }
+    puts(cwd);
+    return true;
+}
+
+
+/**
+ * `exit [n]` leaves the shell with the status `n` (0 by default). In a
+ * background job or a pipeline stage, only that copy of the shell exits.
+ * @return  false if `n` is not a number, in which case the shell stays.
+ * */
+int exit_builtin (Command* cmd){
+    int status = EXIT_SUCCESS;
+
+    if (cmd->cmd[1] != NULL){
+        char* end;
+        long value = strtol(cmd->cmd[1], &end, 10);
+        if (*end != 0 || end == cmd->cmd[1]){
+            fprintf(stderr, "exit: %s: numeric argument required\n",
+                    cmd->cmd[1]);
+            return false;
+        }
+        status = (int) (value & 0xff);
+    }
+
+    shell_exit(status);
+    return false;  // not reached
+}
+
+
+#endif //TESTSHELL_BUILTINS_H
@@ -0,0 +1,433 @@
+#ifndef TESTSHELL_BYTECODE_H
+#define TESTSHELL_BYTECODE_H
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "expression.h"
+#include "ast_cache.h"
+#include "job_usage.h"
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define COMPILE_STACK_MIN 16
+#define TIME_FRAMES_LOCAL 4         // nested `time` run without malloc()
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * Instructions of the compiled form of a tree. The virtual machine only
+ * has one register: the result of the last command, which the jumps test.
+ *
+ *  a && b          a; JUMP_IF_FAIL end; b; end:
+ *  a || b          a; JUMP_IF_OK end; b; end:
+ *  if c ; do s done
+ *                  c; JUMP_IF_FAIL else; s; JUMP end; else: LOAD 1; end:
+ *  time x          TIME; x; TIME_END
+ * */
+typedef enum op_code {
+    OP_RUN,             // run_command(cmd)
+    OP_PIPE,            // run_pipeline(exp)
+    OP_JUMP_IF_FAIL,
+    OP_JUMP_IF_OK,
+    OP_JUMP,
+    OP_LOAD,            // result = target
+    OP_TIME,
+    OP_TIME_END,
+    OP_HALT
+} op_code;
+
+
+typedef struct Instruction {
+    op_code             op;
+    int                 target;     // of a jump, or the value of a LOAD
+    union {
+        Command*        cmd;
+        Expression*     exp;
+    }                   arg;
+} Instruction;
+
+
+/**
+ * A whole tree, flattened. It only points to the commands of the tree, so
+ * it lives as long as the tree: in the entry of the AST_CACHE when the
+ * tree is cached, in the LINE_ARENA otherwise.
+ * */
+typedef struct Program {
+    Instruction*        code;
+    int                 size;
+    int                 time_depth; // deepest nesting of `time`
+} Program;
+
+
+/**
+ * What is left to do to compile a node. The compiler keeps them on a stack
+ * instead of recursing, so a chain of a million '&&' is not a problem.
+ * */
+typedef enum compile_step {
+    STEP_NODE,          // emit the code of `exp`
+    STEP_JUMP_IF_FAIL,  // emit a jump, to patch later
+    STEP_JUMP_IF_OK,
+    STEP_ELSE,          // end of an if body: jump over the else
+    STEP_PATCH,         // the last jump to patch lands here
+    STEP_TIME_END
+} compile_step;
+
+typedef struct Compile_item {
+    compile_step        step;
+    Expression*         exp;
+} Compile_item;
+
+
+typedef struct Compiler {
+    Instruction*        code;
+    int                 size;
+    int                 capacity;
+    Compile_item*       items;
+    int                 item_count;
+    int                 item_capacity;
+    int*                patches;    // jumps waiting for their target
+    int                 patch_count;
+    int                 patch_capacity;
+    int                 time_depth;
+    int                 max_time_depth;
+} Compiler;
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+Program* compile             (Arena* arena, Expression* exp);
+bool     compile_node        (Compiler* c, Expression* exp);
+bool     compile_push        (Compiler* c, compile_step step,
+                              Expression* exp);
+int      compile_emit        (Compiler* c, op_code op, int target);
+bool     compile_patch_push  (Compiler* c, int at);
+void     compile_free        (Compiler* c);
+int      run_program         (const Program* program);
+Program* ast_cache_program   (Ast_cache* cache, Expression* ast);
+
+
+
+
+/* ********************************************************
+ * COMPILER
+ * ****************************************************** */
+
+
+/**
+ * Flattens a tree into a Program allocated in `arena`.
+ * @return  the program, or NULL when out of memory.
+ * */
+Program* compile (Arena* arena, Expression* exp){
+    Compiler c;
+    memset(&c, 0, sizeof(c));
+    bool ok = compile_push(&c, STEP_NODE, exp);
+
+    while (ok && c.item_count > 0){
+        Compile_item item = c.items[--c.item_count];
+        int at;
+
+        switch (item.step){
+            case STEP_NODE:
+                ok = compile_node(&c, item.exp);
+                break;
+            case STEP_JUMP_IF_FAIL:
+            case STEP_JUMP_IF_OK:
+                at = compile_emit(&c, item.step == STEP_JUMP_IF_FAIL
+                                      ? OP_JUMP_IF_FAIL : OP_JUMP_IF_OK, -1);
+                ok = at >= 0 && compile_patch_push(&c, at);
+                break;
+            case STEP_ELSE:
+                at = compile_emit(&c, OP_JUMP, -1);
+                ok = at >= 0;
+                if (ok){
+                    // the condition failed: jump past the body to the LOAD
+                    c.code[c.patches[--c.patch_count]].target = c.size;
+                    ok = compile_patch_push(&c, at)
+                         && compile_emit(&c, OP_LOAD, true) >= 0;
+                }
+                break;
+            case STEP_PATCH:
+                c.code[c.patches[--c.patch_count]].target = c.size;
+                break;
+            case STEP_TIME_END:
+                c.time_depth--;
+                ok = compile_emit(&c, OP_TIME_END, 0) >= 0;
+                break;
+        }
+    }
+    ok = ok && compile_emit(&c, OP_HALT, 0) >= 0;
+
+    Program* program = NULL;
+    if (ok){
+        program = arena_alloc(arena, sizeof(Program));
+        Instruction* code = arena_alloc(arena, c.size * sizeof(Instruction));
+        if (program != NULL && code != NULL){
+            memcpy(code, c.code, c.size * sizeof(Instruction));
+            program->code = code;
+            program->size = c.size;
+            program->time_depth = c.max_time_depth;
+        } else {
+            program = NULL;
+        }
+    }
+    compile_free(&c);
+    return program;
+}
+
+
+/**
+ * Emits the code of a leaf, or pushes what an inner node is made of. The
+ * items are popped in the reverse order: the left side comes out first.
+ * */
+bool compile_node (Compiler* c, Expression* exp){
+    if (exp == NULL){
+        return compile_emit(c, OP_LOAD, false) >= 0;
+    }
+
+    Expression* left  = exp->node.cond_expr.left;
+    Expression* right = exp->node.cond_expr.right;
+    int at;
+
+    switch (exp->id){
+        case COMMAND:
+            at = compile_emit(c, OP_RUN, 0);
+            if (at >= 0) c->code[at].arg.cmd = exp->node.cmd_expr;
+            return at >= 0;
+        case PIPE_EXPRESSION:
+            at = compile_emit(c, OP_PIPE, 0);
+            if (at >= 0) c->code[at].arg.exp = exp;
+            return at >= 0;
+        case AND_EXPRESSION:
+        case OR_EXPRESSION:
+            return compile_push(c, STEP_PATCH, NULL)
+                && compile_push(c, STEP_NODE, right)
+                && compile_push(c, exp->id == AND_EXPRESSION
+                                   ? STEP_JUMP_IF_FAIL : STEP_JUMP_IF_OK, NULL)
+                && compile_push(c, STEP_NODE, left);
+        case IF_EXPRESSION:
+            return compile_push(c, STEP_PATCH, NULL)
+                && compile_push(c, STEP_ELSE, NULL)
+                && compile_push(c, STEP_NODE, right)
+                && compile_push(c, STEP_JUMP_IF_FAIL, NULL)
+                && compile_push(c, STEP_NODE, left);
+        case TIME_EXPRESSION:
+            if (++c->time_depth > c->max_time_depth){
+                c->max_time_depth = c->time_depth;
+            }
+            return compile_emit(c, OP_TIME, 0) >= 0
+                && compile_push(c, STEP_TIME_END, NULL)
+                && compile_push(c, STEP_NODE, left);
+        default:
+            return compile_emit(c, OP_LOAD, false) >= 0;
+    }
+}
+
+
+bool compile_push (Compiler* c, compile_step step, Expression* exp){
+    if (c->item_count == c->item_capacity){
+        int capacity = c->item_capacity ? c->item_capacity * 2
+                                        : COMPILE_STACK_MIN;
+        Compile_item* items = realloc(c->items,
+                                      capacity * sizeof(Compile_item));
+        if (items == NULL){
+            return false;
+        }
+        c->items = items;
+        c->item_capacity = capacity;
+    }
+    c->items[c->item_count++] = (Compile_item) {step, exp};
+    return true;
+}
+
+
+/**
+ * @return  the index of the new instruction, or -1 when out of memory.
+ * */
+int compile_emit (Compiler* c, op_code op, int target){
+    if (c->size == c->capacity){
+        int capacity = c->capacity ? c->capacity * 2 : COMPILE_STACK_MIN;
+        Instruction* code = realloc(c->code, capacity * sizeof(Instruction));
+        if (code == NULL){
+            return -1;
+        }
+        c->code = code;
+        c->capacity = capacity;
+    }
+    c->code[c->size].op = op;
+    c->code[c->size].target = target;
+    c->code[c->size].arg.exp = NULL;
+    return c->size++;
+}
+
+
+bool compile_patch_push (Compiler* c, int at){
+    if (c->patch_count == c->patch_capacity){
+        int capacity = c->patch_capacity ? c->patch_capacity * 2
+                                         : COMPILE_STACK_MIN;
+        int* patches = realloc(c->patches, capacity * sizeof(int));
+        if (patches == NULL){
+            return false;
+        }
+        c->patches = patches;
+        c->patch_capacity = capacity;
+    }
+    c->patches[c->patch_count++] = at;
+    return true;
+}
+
+
+void compile_free (Compiler* c){
+    free(c->code);
+    free(c->items);
+    free(c->patches);
+}
+
+
+/**
+ * The program of a cached tree, compiled the first time it is asked for.
+ * Only the most recently used entry is looked at: it is the one `get_ast()`
+ * just returned.
+ * @return  the program, or NULL if `ast` is not the tree of that entry.
+ * */
+Program* ast_cache_program (Ast_cache* cache, Expression* ast){
+    Ast_entry* entry = cache->newest;
+    if (entry == NULL || entry->ast != ast){
+        return NULL;
+    }
+    if (entry->program == NULL){
+        entry->program = compile(&entry->memory, ast);
+    }
+    return entry->program;
+}
+
+
+
+
+/* ********************************************************
+ * VIRTUAL MACHINE
+ * ****************************************************** */
+
+
+/**
+ * Runs a compiled tree. Every command and pipeline is a span of the trace,
+ * like the `time` it may be part of.
+ * @return  int     a boolean representing if the evaluation
+ *                  has succeeded or not.
+ * */
+int run_program (const Program* program){
+    Time_frame  local[TIME_FRAMES_LOCAL];
+    Time_frame* frames = local;
+    double      time_starts[TIME_FRAMES_LOCAL];
+    double*     starts = time_starts;
+    int         depth = 0;
+
+    if (program->time_depth > TIME_FRAMES_LOCAL){
+        frames = malloc(program->time_depth * sizeof(Time_frame));
+        starts = malloc(program->time_depth * sizeof(double));
+        if (frames == NULL || starts == NULL){
+            perror("malloc error run_program");
+            free(frames);
+            free(starts);
+            return false;
+        }
+    }
+
+    const Instruction* code = program->code;
+    int result = false;
+    int pc = 0;
+
+    while (code[pc].op != OP_HALT){
+        const Instruction* in = &code[pc++];
+        double start;
+
+        switch (in->op){
+            case OP_RUN:
+                start = trace_start();
+                result = run_command(in->arg.cmd);
+                trace_span(enumStrings[COMMAND], start, in->arg.cmd->cmd, 0);
+                break;
+            case OP_PIPE:
+                start = trace_start();
+                result = run_pipeline(in->arg.exp);
+                trace_span(enumStrings[PIPE_EXPRESSION], start, NULL, 0);
+                break;
+            case OP_JUMP_IF_FAIL:
+                if (!result) pc = in->target;
+                break;
+            case OP_JUMP_IF_OK:
+                if (result) pc = in->target;
+                break;
+            case OP_JUMP:
+                pc = in->target;
+                break;
+            case OP_LOAD:
+                result = in->target;
+                break;
+            case OP_TIME:
+                starts[depth] = trace_start();
+                time_start(&frames[depth++]);
+                break;
+            case OP_TIME_END:
+                time_stop(&frames[--depth]);
+                trace_span(enumStrings[TIME_EXPRESSION], starts[depth],
+                           NULL, 0);
+                break;
+            case OP_HALT:
+                break;
+        }
+    }
+
+    if (frames != local){
+        free(frames);
+        free(starts);
+    }
+    return result;
+}
+
+
+/**
+ * The entry point for evaluating a node of the Abstract Syntax Tree: the
+ * tree is compiled, or its program taken from the AST_CACHE, then run.
+ *
+ * @param   exp     the node of the AST to evaluate.
+ * @return  int     a boolean representing if the evaluation
+ *                  has succeeded or not.
+ * */
+int eval (Expression* exp){
+    if (exp == NULL){
+        return false;
+    }
+
+    Program* program = ast_cache_program(&AST_CACHE, exp);
+    if (program == NULL){
+        program = compile(&LINE_ARENA, exp);
+    }
+    if (program == NULL){
+        perror("malloc error eval");
+        return false;
+    }
+    return run_program(program);
+}
+
+
+#endif //TESTSHELL_BYTECODE_H
@@ -0,0 +1,875 @@
+#ifndef TESTSHELL_COMPLETION_H
+#define TESTSHELL_COMPLETION_H
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <limits.h>
+#include <dirent.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/vfs.h>
+#include <sys/ioctl.h>
+#include <sys/inotify.h>
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define TRIE_SOURCES 63             // directories of $PATH that are watched
+#define TRIE_SHELL (1ULL << 63)     // source bit of the builtins
+#define TRIE_NONE UINT32_MAX
+#define TRIE_EVENTS (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO \
+                     | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF)
+#define TRIE_STAT_INTERVAL 5        // seconds between two looks at the
+                                    // directories inotify does not watch
+
+/* File systems changed by other machines, which inotify never hears of:
+ * NFS, SMB/CIFS (both dialects), FUSE, 9P, AFS, Coda, Ceph and Lustre. */
+static const long remoteFileSystems[] = {0x6969, 0x517B, 0xFF534D42,
+    0xFE534D42, 0x65735546, 0x01021997, 0x5346414F, 0x73757245, 0x00C36400,
+    0x0BD00BD0};
+
+#define DIR_CACHE_MAX 32            // directories listed
+#define DIR_CACHE_BYTES (8 << 20)   // bytes of their listings, roughly
+
+#define COMPLETION_LIST_MAX 200     // candidates shown by an ambiguous Tab
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * A character of a command name. The children of a node are a list of
+ * siblings sorted by character, so the names come out in order.
+ * */
+typedef struct Trie_node {
+    uint64_t        sources;        // a bit per directory that has it
+    uint32_t        child;
+    uint32_t        sibling;
+    uint32_t        below;          // names in the subtree, this one too
+    char            c;
+} Trie_node;
+
+
+/**
+ * Prefix tree of every command name: the builtins and the executables of
+ * the absolute directories of $PATH. It is built on the first Tab, then
+ * kept up to date by the inotify events of the directories, read at every
+ * Tab. A directory inotify cannot watch (past the limit of the watches),
+ * or on a remote file system where its watch would miss the changes made
+ * elsewhere, is looked at again when its mtime changes, every few seconds
+ * at most.
+ * */
+typedef struct Command_trie {
+    Trie_node*      nodes;          // the root is the first
+    uint32_t        size;
+    uint32_t        capacity;
+    char*           path_var;       // $PATH it was built from
+    int             inotify;
+    int             dir_count;
+    char*           dirs[TRIE_SOURCES];
+    int             watches[TRIE_SOURCES];
+    bool            polled[TRIE_SOURCES];   // by mtime, inotify is not enough
+    struct timespec mtimes[TRIE_SOURCES];
+    time_t          checked;        // last look at the unwatched ones
+} Command_trie;
+
+
+/**
+ * The sorted names of a directory, subdirectories ending with a '/'.
+ * Valid as long as the mtime of the directory stays the same.
+ * */
+typedef struct Dir_listing {
+    char*                   path;   // absolute
+    struct timespec         mtime;
+    char**                  names;
+    size_t                  count;
+    Arena                   memory;
+    struct Dir_listing*     older;  // LRU list
+} Dir_listing;
+
+
+typedef struct Dir_cache {
+    Dir_listing*    newest;
+    size_t          size;
+    size_t          bytes;
+} Dir_cache;
+
+
+Command_trie COMMAND_TRIE = {NULL, 0, 0, NULL, -1, 0, {NULL}, {0}, {false},
+                             {{0, 0}}, 0};
+Dir_cache    DIR_CACHE = {NULL, 0, 0};
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+size_t   complete_word      (const char* word, size_t len, bool command,
+                             char* out, size_t size, size_t* out_len);
+void     list_completions   (const char* word, size_t len, bool command);
+void     print_columns      (char** names, size_t count, size_t total);
+bool     complete_files     (const char* word, size_t len,
+                             Dir_listing** listing, size_t* first,
+                             size_t* count, const char** base);
+void     completion_free    ();
+
+bool     trie_refresh       (Command_trie* t);
+bool     trie_build         (Command_trie* t);
+void     trie_scan_dir      (Command_trie* t, int source);
+void     trie_read_events   (Command_trie* t);
+bool     trie_set           (Command_trie* t, const char* name,
+                             uint64_t source, bool present);
+uint32_t trie_find          (const Command_trie* t, const char* prefix,
+                             size_t len);
+uint32_t trie_new_node      (Command_trie* t, char c);
+size_t   trie_collect       (const Command_trie* t, uint32_t node,
+                             const char* prefix, size_t len, char** names,
+                             size_t max);
+void     trie_free          (Command_trie* t);
+bool     is_executable      (int dir_fd, const char* name);
+bool     is_remote          (int fd);
+
+Dir_listing* dir_cache_get  (Dir_cache* cache, const char* path);
+Dir_listing* dir_list       (const char* path, const struct timespec* mtime);
+void     dir_listing_free   (Dir_listing* listing);
+int      compare_prefix     (const char* name, const char* prefix,
+                             size_t len);
+int      compare_names      (const void* a, const void* b);
+
+
+
+
+/* ********************************************************
+ * COMPLETION FUNCTIONS
+ * ****************************************************** */
+
+
+/**
+ * Completes the word before the cursor: a command name in the position of
+ * a command (unless it has a '/'), a file name anywhere else.
+ * @param   out     what to insert after the word: the common part of the
+ *                  candidates, plus a ' ' (or nothing after a directory)
+ *                  if there is only one.
+ * @return  the number of candidates.
+ * */
+size_t complete_word (const char* word, size_t len, bool command,
+                      char* out, size_t size, size_t* out_len){
+    *out_len = 0;
+
+    if (command && memchr(word, '/', len) == NULL){
+        Command_trie* t = &COMMAND_TRIE;
+        if (!trie_refresh(t)){
+            return 0;
+        }
+        uint32_t node = trie_find(t, word, len);
+        if (node == TRIE_NONE || t->nodes[node].below == 0){
+            return 0;
+        }
+        size_t count = t->nodes[node].below;
+
+        // go down while there is a single way to go
+        while (t->nodes[node].sources == 0 && *out_len + 2 < size){
+            uint32_t next = TRIE_NONE;
+            for (uint32_t c = t->nodes[node].child; c != TRIE_NONE;
+                                                    c = t->nodes[c].sibling){
+                if (t->nodes[c].below == 0) continue;
+                if (next != TRIE_NONE){
+                    next = TRIE_NONE;
+                    break;
+                }
+                next = c;
+            }
+            if (next == TRIE_NONE) break;
+            out[(*out_len)++] = t->nodes[next].c;
+            node = next;
+        }
+        if (count == 1){
+            out[(*out_len)++] = ' ';
+        }
+        out[*out_len] = 0;
+        return count;
+    }
+
+    Dir_listing* listing;
+    size_t       first, count;
+    const char*  base;
+    if (!complete_files(word, len, &listing, &first, &count, &base)){
+        return 0;
+    }
+
+    // the common part of the first and the last candidates is everyone's
+    size_t      base_len = (size_t) (word + len - base);
+    const char* low = listing->names[first];
+    const char* high = listing->names[first + count - 1];
+    size_t      common = base_len;
+    while (low[common] != 0 && low[common] == high[common]) common++;
+
+    if (common - base_len + 2 > size){
+        return count;
+    }
+    memcpy(out, low + base_len, common - base_len);
+    *out_len = common - base_len;
+    if (count == 1 && (*out_len == 0 || out[*out_len - 1] != '/')){
+        out[(*out_len)++] = ' ';
+    }
+    out[*out_len] = 0;
+    return count;
+}
+
+
+/**
+ * Shows the candidates of an ambiguous Tab, on the lines below the prompt.
+ * */
+void list_completions (const char* word, size_t len, bool command){
+    char*  names[COMPLETION_LIST_MAX];
+    size_t count = 0;
+    size_t total = 0;
+
+    if (command && memchr(word, '/', len) == NULL){
+        Command_trie* t = &COMMAND_TRIE;
+        uint32_t node = trie_find(t, word, len);
+        if (node == TRIE_NONE){
+            return;
+        }
+        total = t->nodes[node].below;
+        count = trie_collect(t, node, word, len, names, COMPLETION_LIST_MAX);
+        printf("\n");
+        print_columns(names, count, total);
+        for (size_t i = 0; i < count; i++){
+            free(names[i]);
+        }
+        return;
+    }
+
+    Dir_listing* listing;
+    size_t       first;
+    const char*  base;
+    if (complete_files(word, len, &listing, &first, &total, &base)){
+        count = total < COMPLETION_LIST_MAX ? total : COMPLETION_LIST_MAX;
+        printf("\n");
+        print_columns(listing->names + first, count, total);
+    }
+}
+
+
+void print_columns (char** names, size_t count, size_t total){
+    struct winsize size;
+    size_t width = 80;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_col > 0){
+        width = size.ws_col;
+    }
+
+    size_t longest = 1;
+    for (size_t i = 0; i < count; i++){
+        size_t len = strlen(names[i]);
+        if (len > longest) longest = len;
+    }
+    size_t columns = width / (longest + 2);
+    if (columns == 0) columns = 1;
+    size_t rows = (count + columns - 1) / columns;
+
+    for (size_t r = 0; r < rows; r++){
+        for (size_t i = r; i < count; i += rows){
+            printf("%-*s", (int) (longest + 2), names[i]);
+        }
+        printf("\n");
+    }
+    if (total > count){
+        printf("... and %zu more\n", total - count);
+    }
+}
+
+
+/**
+ * Finds the names of the directory of `word` that start with the rest of
+ * the word, hidden ones only if the rest starts with a '.'.
+ * @param   base    set to the part of `word` after its last '/'.
+ * @param   first, count    the candidates, in the listing.
+ * @return  false if there is none.
+ * */
+bool complete_files (const char* word, size_t len, Dir_listing** listing,
+                     size_t* first, size_t* count, const char** base){
+    char   path[PATH_MAX];
+    char   dir[PATH_MAX];
+    const char* slash = memrchr(word, '/', len);
+    size_t dir_len = slash != NULL ? (size_t) (slash - word) + 1 : 0;
+    *base = word + dir_len;
+
+    // the directory as typed: "", "/usr/", "src/", "~/code/"...
+    // (a path too long to fit has no completion, rather than a wrong one)
+    const char* home = var_get(&VARS, "HOME");
+    int n;
+    if (dir_len >= 2 && word[0] == '~' && word[1] == '/' && home != NULL){
+        n = snprintf(dir, sizeof(dir), "%s%.*s", home, (int) dir_len - 1,
+                     word + 1);
+    } else {
+        n = snprintf(dir, sizeof(dir), "%.*s", (int) dir_len, word);
+    }
+    if (n < 0 || (size_t) n >= sizeof(dir)){
+        return false;
+    }
+    if (dir[0] == '/'){
+        memcpy(path, dir, (size_t) n + 1);
+    } else {
+        char cwd[PATH_MAX];
+        if (getcwd(cwd, sizeof(cwd)) == NULL){
+            return false;
+        }
+        n = snprintf(path, sizeof(path), "%s/%s", cwd, dir);
+        if (n < 0 || (size_t) n >= sizeof(path)){
+            return false;
+        }
+    }
+
+    *listing = dir_cache_get(&DIR_CACHE, path);
+    if (*listing == NULL){
+        return false;
+    }
+
+    // binary search of the first name >= base, then of the first > base
+    char** names = (*listing)->names;
+    size_t base_len = len - dir_len;
+    size_t low = 0, high = (*listing)->count;
+    while (low < high){
+        size_t mid = (low + high) / 2;
+        if (compare_prefix(names[mid], *base, base_len) < 0) low = mid + 1;
+        else high = mid;
+    }
+    size_t end = low;
+    high = (*listing)->count;
+    while (end < high){
+        size_t mid = (end + high) / 2;
+        if (compare_prefix(names[mid], *base, base_len) <= 0) end = mid + 1;
+        else high = mid;
+    }
+    *first = low;
+    *count = end - low;
+    return *count > 0;
+}
+
+
+void completion_free (){
+    trie_free(&COMMAND_TRIE);
+    while (DIR_CACHE.newest != NULL){
+        Dir_listing* listing = DIR_CACHE.newest;
+        DIR_CACHE.newest = listing->older;
+        dir_listing_free(listing);
+    }
+    DIR_CACHE.size = 0;
+    DIR_CACHE.bytes = 0;
+}
+
+
+
+
+/* ********************************************************
+ * COMMAND TRIE
+ * ****************************************************** */
+
+
+/**
+ * Brings the trie up to date: built again if $PATH changed, otherwise
+ * changed by what happened in the directories.
+ * @return  false if there is no trie (out of memory).
+ * */
+bool trie_refresh (Command_trie* t){
+    const char* path_var = var_get(&VARS, "PATH");
+    if (path_var == NULL) path_var = "";
+    if (t->path_var == NULL || strcmp(t->path_var, path_var) != 0){
+        return trie_build(t);
+    }
+
+    trie_read_events(t);
+
+    time_t now = time(NULL);
+    if (now - t->checked < TRIE_STAT_INTERVAL){
+        return t->nodes != NULL;
+    }
+    t->checked = now;
+    for (int d = 0; d < t->dir_count; d++){
+        struct stat st;
+        if (!t->polled[d] || stat(t->dirs[d], &st) < 0){
+            continue;
+        }
+        if (st.st_mtim.tv_sec != t->mtimes[d].tv_sec
+                || st.st_mtim.tv_nsec != t->mtimes[d].tv_nsec){
+            return trie_build(t);
+        }
+    }
+    return t->nodes != NULL;
+}
+
+
+/**
+ * Lists the builtins and every directory of $PATH again, from scratch.
+ * */
+bool trie_build (Command_trie* t){
+    trie_free(t);
+    const char* path_var = var_get(&VARS, "PATH");
+    t->path_var = strdup(path_var != NULL ? path_var : "");
+    if (t->path_var == NULL || trie_new_node(t, 0) == TRIE_NONE){
+        trie_free(t);
+        return false;
+    }
+    t->inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    t->checked = time(NULL);
+
+    size_t builtins = sizeof(builtinTable) / sizeof(builtinTable[0]);
+    for (size_t b = 0; b < builtins; b++){
+        trie_set(t, builtinTable[b].name, TRIE_SHELL, true);
+    }
+
+    // only the absolute directories: the others change with `cd`
+    const char* dir = t->path_var;
+    while (*dir != 0 && t->dir_count < TRIE_SOURCES){
+        const char* end = strchr(dir, ':');
+        size_t len = end != NULL ? (size_t) (end - dir) : strlen(dir);
+        if (len > 0 && dir[0] == '/'){
+            int d = t->dir_count++;
+            t->dirs[d] = strndup(dir, len);
+            t->watches[d] = -1;
+            t->polled[d] = false;
+            if (t->dirs[d] != NULL){
+                trie_scan_dir(t, d);
+            }
+        }
+        dir += len + (end != NULL);
+    }
+    return true;
+}
+
+
+/**
+ * Adds the executables of a directory, and starts watching it (before
+ * reading it, so that nothing happens unseen in between).
+ * */
+void trie_scan_dir (Command_trie* t, int source){
+    const char* path = t->dirs[source];
+    if (t->inotify >= 0){
+        t->watches[source] = inotify_add_watch(t->inotify, path, TRIE_EVENTS);
+    }
+    struct stat st;
+    if (stat(path, &st) == 0){
+        t->mtimes[source] = st.st_mtim;
+    }
+
+    DIR* dir = opendir(path);
+    t->polled[source] = t->watches[source] < 0
+                        || (dir != NULL && is_remote(dirfd(dir)));
+    if (dir == NULL){
+        return;
+    }
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL){
+        if (entry->d_name[0] == '.' || entry->d_type == DT_DIR){
+            continue;
+        }
+        if (is_executable(dirfd(dir), entry->d_name)){
+            trie_set(t, entry->d_name, 1ULL << source, true);
+        }
+    }
+    closedir(dir);
+}
+
+
+/**
+ * Applies what inotify saw since the last Tab. The commands found by the
+ * PATH_CACHE for the names involved are forgotten too: a new file may
+ * hide the one it knows.
+ * */
+void trie_read_events (Command_trie* t){
+    char buffer[16 * 1024]
+        __attribute__ ((aligned(__alignof__(struct inotify_event))));
+
+    while (t->inotify >= 0){
+        ssize_t got = read(t->inotify, buffer, sizeof(buffer));
+        if (got <= 0){
+            return;  // EAGAIN: nothing more
+        }
+
+        for (char* at = buffer; at < buffer + got;){
+            struct inotify_event* event = (struct inotify_event*) at;
+            at += sizeof(struct inotify_event) + event->len;
+
+            if (event->mask & (IN_Q_OVERFLOW | IN_DELETE_SELF | IN_MOVE_SELF)){
+                trie_build(t);  // too much to follow
+                return;
+            }
+            int d = 0;
+            while (d < t->dir_count && t->watches[d] != event->wd) d++;
+            if (d == t->dir_count || event->len == 0
+                    || event->name[0] == '.'){
+                continue;
+            }
+
+            bool present = false;
+            if (event->mask & (IN_CREATE | IN_MOVED_TO | IN_ATTRIB)){
+                int dir_fd = open(t->dirs[d], O_RDONLY | O_DIRECTORY
+                                              | O_CLOEXEC);
+                present = dir_fd >= 0 && is_executable(dir_fd, event->name);
+                if (dir_fd >= 0) close(dir_fd);
+            }
+            trie_set(t, event->name, 1ULL << d, present);
+            path_cache_forget(&PATH_CACHE, event->name);
+        }
+    }
+}
+
+
+/**
+ * Marks a name as provided (or not anymore) by a source. The nodes are
+ * never removed: a name that disappears often comes back.
+ * */
+bool trie_set (Command_trie* t, const char* name, uint64_t source,
+               bool present){
+    uint32_t path[NAME_MAX + 2];
+    size_t   depth = 0;
+    uint32_t node = 0;
+    path[depth++] = node;
+
+    for (const char* c = name; *c != 0 && depth <= NAME_MAX; c++){
+        uint32_t* link = &t->nodes[node].child;
+        while (*link != TRIE_NONE && t->nodes[*link].c < *c){
+            link = &t->nodes[*link].sibling;
+        }
+        if (*link == TRIE_NONE || t->nodes[*link].c != *c){
+            if (!present){
+                return true;  // was never there
+            }
+            size_t offset = (size_t) ((char*) link - (char*) t->nodes);
+            uint32_t next = trie_new_node(t, *c);
+            if (next == TRIE_NONE){
+                return false;
+            }
+            link = (uint32_t*) ((char*) t->nodes + offset);  // moved
+            t->nodes[next].sibling = *link;
+            *link = next;
+        }
+        node = *link;
+        path[depth++] = node;
+    }
+
+    uint64_t before = t->nodes[node].sources;
+    if (present) t->nodes[node].sources |= source;
+    else         t->nodes[node].sources &= ~source;
+
+    bool was = before != 0;
+    bool is = t->nodes[node].sources != 0;
+    if (was != is){
+        for (size_t i = 0; i < depth; i++){
+            t->nodes[path[i]].below += is ? 1 : -1;
+        }
+    }
+    return true;
+}
+
+
+/**
+ * @return  the node of the last character of `prefix`, or TRIE_NONE.
+ * */
+uint32_t trie_find (const Command_trie* t, const char* prefix, size_t len){
+    if (t->nodes == NULL){
+        return TRIE_NONE;
+    }
+    uint32_t node = 0;
+    for (size_t i = 0; i < len && node != TRIE_NONE; i++){
+        node = t->nodes[node].child;
+        while (node != TRIE_NONE && t->nodes[node].c != prefix[i]){
+            node = t->nodes[node].sibling;
+        }
+    }
+    return node;
+}
+
+
+uint32_t trie_new_node (Command_trie* t, char c){
+    if (t->size == t->capacity){
+        uint32_t capacity = t->capacity ? t->capacity * 2 : 1024;
+        Trie_node* nodes = realloc(t->nodes, capacity * sizeof(Trie_node));
+        if (nodes == NULL){
+            return TRIE_NONE;
+        }
+        t->nodes = nodes;
+        t->capacity = capacity;
+    }
+    t->nodes[t->size] = (Trie_node) {0, TRIE_NONE, TRIE_NONE, 0, c};
+    return t->size++;
+}
+
+
+/**
+ * Copies the names below `node` (which spells `prefix`), in order.
+ * @return  how many were copied in `names`, at most `max` (malloc'd).
+ * */
+size_t trie_collect (const Command_trie* t, uint32_t node,
+                     const char* prefix, size_t len, char** names,
+                     size_t max){
+    char     name[NAME_MAX + 1];
+    uint32_t stack[NAME_MAX + 1];   // the node of every character
+    size_t   depth = 0;
+    size_t   count = 0;
+
+    if (len > NAME_MAX){
+        return 0;
+    }
+    memcpy(name, prefix, len);
+    uint32_t current = node;
+
+    // depth-first, each node before its children, the siblings in order
+    while (count < max){
+        if (t->nodes[current].below > 0){
+            if (t->nodes[current].sources != 0){
+                name[len + depth] = 0;
+                names[count] = strdup(name);
+                if (names[count] == NULL) break;
+                count++;
+            }
+            uint32_t child = t->nodes[current].child;
+            if (child != TRIE_NONE && len + depth < NAME_MAX){
+                stack[depth] = child;
+                name[len + depth] = t->nodes[child].c;
+                depth++;
+                current = child;
+                continue;
+            }
+        }
+        // next sibling, going up where there is none
+        while (depth > 0 && t->nodes[stack[depth - 1]].sibling == TRIE_NONE){
+            depth--;
+        }
+        if (depth == 0){
+            break;
+        }
+        current = stack[depth - 1] = t->nodes[stack[depth - 1]].sibling;
+        name[len + depth - 1] = t->nodes[current].c;
+    }
+    return count;
+}
+
+
+void trie_free (Command_trie* t){
+    free(t->nodes);
+    free(t->path_var);
+    for (int d = 0; d < t->dir_count; d++){
+        free(t->dirs[d]);
+    }
+    if (t->inotify >= 0) close(t->inotify);
+    t->nodes = NULL;
+    t->size = 0;
+    t->capacity = 0;
+    t->path_var = NULL;
+    t->inotify = -1;
+    t->dir_count = 0;
+}
+
+
+/**
+ * A regular file (or a link to one) with an execute bit.
+ * */
+bool is_executable (int dir_fd, const char* name){
+    struct stat st;
+    return fstatat(dir_fd, name, &st, 0) == 0 && S_ISREG(st.st_mode)
+        && (st.st_mode & (S_IXUSR | S_IXGRP | S_IXOTH)) != 0;
+}
+
+
+/**
+ * @return  true if `fd` is on one of the `remoteFileSystems`.
+ * */
+bool is_remote (int fd){
+    struct statfs fs;
+    if (fstatfs(fd, &fs) < 0){
+        return false;
+    }
+    size_t count = sizeof(remoteFileSystems) / sizeof(remoteFileSystems[0]);
+    for (size_t i = 0; i < count; i++){
+        if ((uint32_t) fs.f_type == (uint32_t) remoteFileSystems[i]){
+            return true;
+        }
+    }
+    return false;
+}
+
+
+
+
+/* ********************************************************
+ * DIRECTORY CACHE
+ * ****************************************************** */
+
+
+/**
+ * The listing of a directory, read again only if its mtime changed. The
+ * least recently used listings go when there are more than DIR_CACHE_MAX
+ * of them or when they take more than DIR_CACHE_BYTES (the last one read
+ * is always kept).
+ * @return  the listing, or NULL if the directory cannot be read.
+ * */
+Dir_listing* dir_cache_get (Dir_cache* cache, const char* path){
+    struct stat st;
+    if (stat(path, &st) < 0 || !S_ISDIR(st.st_mode)){
+        return NULL;
+    }
+
+    Dir_listing** link = &cache->newest;
+    while (*link != NULL && strcmp((*link)->path, path) != 0){
+        link = &(*link)->older;
+    }
+
+    Dir_listing* listing = *link;
+    if (listing != NULL){
+        *link = listing->older;  // out of the list, back in front below
+        if (listing->mtime.tv_sec != st.st_mtim.tv_sec
+                || listing->mtime.tv_nsec != st.st_mtim.tv_nsec){
+            cache->size--;
+            cache->bytes -= listing->memory.total;
+            dir_listing_free(listing);
+            listing = NULL;
+        }
+    }
+    if (listing == NULL){
+        listing = dir_list(path, &st.st_mtim);
+        if (listing == NULL){
+            return NULL;
+        }
+        cache->size++;
+        cache->bytes += listing->memory.total;
+    }
+    listing->older = cache->newest;
+    cache->newest = listing;
+
+    // evict from the oldest end
+    while (cache->size > 1 && (cache->size > DIR_CACHE_MAX
+                               || cache->bytes > DIR_CACHE_BYTES)){
+        Dir_listing** oldest = &cache->newest;
+        while ((*oldest)->older != NULL) oldest = &(*oldest)->older;
+        cache->size--;
+        cache->bytes -= (*oldest)->memory.total;
+        dir_listing_free(*oldest);
+        *oldest = NULL;
+    }
+    return listing;
+}
+
+
+/**
+ * Reads and sorts the names of a directory in a new listing.
+ * */
+Dir_listing* dir_list (const char* path, const struct timespec* mtime){
+    DIR* dir = opendir(path);
+    if (dir == NULL){
+        return NULL;
+    }
+
+    Dir_listing* listing = calloc(1, sizeof(Dir_listing));
+    size_t capacity = 64;
+    char** names = malloc(capacity * sizeof(char*));
+    if (listing == NULL || names == NULL){
+        free(listing);
+        free(names);
+        closedir(dir);
+        return NULL;
+    }
+    listing->path = arena_strdup(&listing->memory, path);
+    listing->mtime = *mtime;
+
+    struct dirent* entry;
+    bool ok = listing->path != NULL;
+    while (ok && (entry = readdir(dir)) != NULL){
+        const char* name = entry->d_name;
+        if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0){
+            continue;
+        }
+        bool is_dir = entry->d_type == DT_DIR;
+        if (entry->d_type == DT_LNK || entry->d_type == DT_UNKNOWN){
+            struct stat st;
+            is_dir = fstatat(dirfd(dir), name, &st, 0) == 0
+                     && S_ISDIR(st.st_mode);
+        }
+
+        if (listing->count == capacity){
+            capacity *= 2;
+            char** more = realloc(names, capacity * sizeof(char*));
+            if (more == NULL){
+                ok = false;
+                break;
+            }
+            names = more;
+        }
+        size_t len = strlen(name);
+        char*  copy = arena_alloc(&listing->memory, len + 2);
+        if (copy == NULL){
+            ok = false;
+            break;
+        }
+        memcpy(copy, name, len);
+        copy[len] = is_dir ? '/' : 0;
+        copy[len + 1] = 0;
+        names[listing->count++] = copy;
+    }
+    closedir(dir);
+
+    if (ok){
+        qsort(names, listing->count, sizeof(char*), compare_names);
+        listing->names = arena_alloc(&listing->memory,
+                                     listing->count * sizeof(char*) + 1);
+        ok = listing->names != NULL;
+    }
+    if (!ok){
+        free(names);
+        dir_listing_free(listing);
+        return NULL;
+    }
+    memcpy(listing->names, names, listing->count * sizeof(char*));
+    free(names);
+    return listing;
+}
+
+
+void dir_listing_free (Dir_listing* listing){
+    arena_release(&listing->memory);
+    free(listing);
+}
+
+
+/**
+ * Order of the listings: the hidden names first, then the others, each
+ * part sorted by strcmp(). Whatever the prefix, its names are together,
+ * and the empty prefix gets all the names that are not hidden.
+ * @return  the sign of `name` minus `prefix`, on `len` characters.
+ * */
+int compare_prefix (const char* name, const char* prefix, size_t len){
+    bool hidden = name[0] == '.';
+    if (hidden != (len > 0 && prefix[0] == '.')){
+        return hidden ? -1 : 1;
+    }
+    return strncmp(name, prefix, len);
+}
+
+
+int compare_names (const void* a, const void* b){
+    const char* x = *(char* const*) a;
+    const char* y = *(char* const*) b;
+    return compare_prefix(x, y, strlen(y) + 1);
+}
+
+
+#endif //TESTSHELL_COMPLETION_H
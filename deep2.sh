@@ -0,0 +1 @@
+if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do if true ; do echo deep done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done done
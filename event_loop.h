@@ -0,0 +1,311 @@
+#ifndef TESTSHELL_EVENT_LOOP_H
+#define TESTSHELL_EVENT_LOOP_H
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/syscall.h>
+#include <sys/resource.h>
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define EVENT_INPUT         1       // the standard input can be read
+#define EVENT_CHILD         2       // a child was reaped, or SIGCHLD came
+#define EVENT_SUSPEND       4       // Ctrl-Z
+#define EVENT_INTERRUPT     8       // Ctrl-C
+#define EVENT_BATCH         32      // events taken by one `epoll_wait()`
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * Everything the shell sleeps on, behind a single `epoll_wait()`: the
+ * standard input when a line is expected, a signalfd of the signals the
+ * shell keeps blocked, and a pidfd of every child it started. No signal
+ * handler ever runs: a child is reaped when its pidfd says it ended, so
+ * the cost is one `wait4()` per child that ended, however many SIGCHLD
+ * the kernel merged into one.
+ * */
+typedef struct Event_loop {
+    int             epoll;      // -1 before `event_loop_open()`
+    int             signals;    // a signalfd of `mask`
+    sigset_t        mask;
+    bool            reading;    // the standard input is watched
+    bool            blind;      // a child got no pidfd: SIGCHLD sweeps
+} Event_loop;
+
+
+/**
+ * A child the shell wants the status of. The EVENT_LOOP fills the status
+ * of the watched children it reaps; any other child is reaped and
+ * forgotten.
+ * */
+typedef struct Watched_child {
+    pid_t               pid;        // 0 for a free slot
+    int                 status;
+    struct rusage       usage;
+    bool                done;
+} Watched_child;
+
+
+Event_loop EVENT_LOOP = {-1, -1, {{0}}, false, false};
+
+
+/**
+ * The children currently watched, or NULL.
+ * */
+Watched_child*  WATCHED = NULL;
+int             WATCHED_COUNT = 0;
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+bool  event_loop_open     (Event_loop* loop, const sigset_t* mask);
+void  event_loop_forked   (Event_loop* loop);
+void  event_loop_close    (Event_loop* loop);
+void  event_loop_watch    (Event_loop* loop, pid_t pid);
+int   event_loop_wait     (Event_loop* loop, bool input);
+bool  event_loop_reap     (Event_loop* loop, int pidfd, pid_t pid);
+int   event_loop_signals  (Event_loop* loop);
+bool  watch_child         (pid_t pid, int status,
+                           const struct rusage* usage);
+int   open_pidfd          (pid_t pid);
+
+
+
+
+/* ********************************************************
+ * SET UP
+ * ****************************************************** */
+
+
+/**
+ * Blocks the signals of `mask` for good and opens the epoll instance
+ * that reads them.
+ * @return  false if the kernel refused; `mask` is then let in again.
+ * */
+bool event_loop_open (Event_loop* loop, const sigset_t* mask){
+    loop->mask = *mask;
+    loop->reading = false;
+    sigprocmask(SIG_BLOCK, mask, NULL);
+
+    loop->signals = signalfd(-1, mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    loop->epoll = epoll_create1(EPOLL_CLOEXEC);
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.u64 = (uint64_t) loop->signals << 32;  // no pid: not a child
+    if (loop->signals < 0 || loop->epoll < 0 || epoll_ctl(loop->epoll,
+                EPOLL_CTL_ADD, loop->signals, &event) < 0){
+        event_loop_close(loop);
+        sigprocmask(SIG_UNBLOCK, mask, NULL);
+        return false;
+    }
+    return true;
+}
+
+
+/**
+ * Called by a forked copy of the shell, which would otherwise share the
+ * epoll instance of the shell: it takes its own, for SIGCHLD alone. The
+ * other signals get their usual effect on the copy again.
+ * */
+void event_loop_forked (Event_loop* loop){
+    sigset_t keys = loop->mask;
+    sigset_t chld;
+    sigdelset(&keys, SIGCHLD);
+    sigemptyset(&chld);
+    sigaddset(&chld, SIGCHLD);
+
+    event_loop_close(loop);
+    sigprocmask(SIG_UNBLOCK, &keys, NULL);
+    if (!event_loop_open(loop, &chld)){
+        perror("event loop");
+        exit(EXIT_FAILURE);
+    }
+}
+
+
+void event_loop_close (Event_loop* loop){
+    if (loop->epoll >= 0) close(loop->epoll);
+    if (loop->signals >= 0) close(loop->signals);
+    loop->epoll = -1;
+    loop->signals = -1;
+}
+
+
+/**
+ * Hands the child `pid` to the loop, which reaps it once it ends and
+ * gives its status to `child_reaped()`. Its pidfd is the key of its
+ * event, next to the PID. Without a pidfd, every SIGCHLD is followed by
+ * a sweep of all the children instead.
+ * */
+void event_loop_watch (Event_loop* loop, pid_t pid){
+    int pidfd = open_pidfd(pid);
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.u64 = ((uint64_t) (uint32_t) pidfd << 32) | (uint32_t) pid;
+    if (pidfd >= 0
+            && epoll_ctl(loop->epoll, EPOLL_CTL_ADD, pidfd, &event) == 0){
+        return;
+    }
+    if (pidfd >= 0) close(pidfd);
+    loop->blind = true;
+}
+
+
+
+
+/* ********************************************************
+ * WAITING
+ * ****************************************************** */
+
+
+/**
+ * Sleeps until something happens, and reaps the children that ended.
+ * Ctrl-Z and Ctrl-C are only reported: what they stop or interrupt is
+ * up to the caller.
+ * @param   input   whether the standard input is waited for too.
+ * @return  the EVENT_ flags of what happened, 0 if nothing did (a signal
+ *          the shell does not block), -1 if the wait failed.
+ * */
+int event_loop_wait (Event_loop* loop, bool input){
+    if (input != loop->reading){
+        struct epoll_event event;
+        event.events = EPOLLIN;
+        event.data.u64 = (uint64_t) STDIN_FILENO << 32;
+        if (epoll_ctl(loop->epoll, input ? EPOLL_CTL_ADD : EPOLL_CTL_DEL,
+                      STDIN_FILENO, &event) < 0 && input){
+            return EVENT_INPUT;  // a plain file: always readable
+        }
+        loop->reading = input;
+    }
+
+    struct epoll_event events[EVENT_BATCH];
+    int count = epoll_wait(loop->epoll, events, EVENT_BATCH, -1);
+    if (count < 0){
+        return errno == EINTR ? 0 : -1;
+    }
+
+    int result = 0;
+    for (int i = 0; i < count; i++){
+        int   fd = (int) (events[i].data.u64 >> 32);
+        pid_t pid = (pid_t) (uint32_t) events[i].data.u64;
+        if (pid != 0){
+            result |= event_loop_reap(loop, fd, pid) ? EVENT_CHILD : 0;
+        } else if (fd == loop->signals){
+            result |= event_loop_signals(loop);
+        } else {
+            result |= EVENT_INPUT;
+        }
+    }
+    return result;
+}
+
+
+/**
+ * Reaps a child whose pidfd became readable, then forgets the pidfd. A
+ * forked copy of the shell may still have it open, so it is taken out
+ * of the interest list before being closed.
+ * @return  true if the child was reaped here, not by an earlier wait.
+ * */
+bool event_loop_reap (Event_loop* loop, int pidfd, pid_t pid){
+    int           status;
+    struct rusage usage;
+    pid_t got = wait4(pid, &status, WNOHANG, &usage);
+    if (got == 0){
+        return false;  // still running
+    }
+    epoll_ctl(loop->epoll, EPOLL_CTL_DEL, pidfd, NULL);
+    close(pidfd);
+    if (got != pid){
+        return false;
+    }
+    child_reaped(pid, status, &usage);
+    return true;
+}
+
+
+/**
+ * Reads the pending signals. A SIGCHLD needs no work here when every
+ * child has a pidfd: it only matters to whoever waits for a stop.
+ * @return  the EVENT_ flags of the signals.
+ * */
+int event_loop_signals (Event_loop* loop){
+    struct signalfd_siginfo info[EVENT_BATCH];
+    ssize_t got = read(loop->signals, info, sizeof(info));
+
+    int result = 0;
+    for (ssize_t i = 0; i < got / (ssize_t) sizeof(info[0]); i++){
+        switch (info[i].ssi_signo){
+            case SIGCHLD:   result |= EVENT_CHILD;      break;
+            case SIGTSTP:   result |= EVENT_SUSPEND;    break;
+            case SIGINT:    result |= EVENT_INTERRUPT;  break;
+            default:                                    break;
+        }
+    }
+
+    if ((result & EVENT_CHILD) && loop->blind){
+        int           status;
+        pid_t         pid;
+        struct rusage usage;
+        while ((pid = wait4(-1, &status, WNOHANG, &usage)) > 0){
+            child_reaped(pid, status, &usage);
+        }
+    }
+    return result;
+}
+
+
+/**
+ * Called by `child_reaped()` for every child the loop reaps.
+ * @return  true if the child was watched.
+ * */
+bool watch_child (pid_t pid, int status, const struct rusage* usage){
+    for (int i = 0; i < WATCHED_COUNT; i++){
+        if (WATCHED[i].pid == pid){
+            WATCHED[i].status = status;
+            WATCHED[i].usage = *usage;
+            WATCHED[i].done = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * @return  a pidfd of the child `pid` (close-on-exec), or -1 when the
+ *          kernel has none.
+ * */
+int open_pidfd (pid_t pid){
+#ifdef SYS_pidfd_open
+    return (int) syscall(SYS_pidfd_open, pid, 0);
+#else
+    (void) pid;
+    return -1;
+#endif
+}
+
+
+#endif //TESTSHELL_EVENT_LOOP_H
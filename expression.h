@@ -2,6 +2,8 @@
 #define TESTSHELL_EXPRESSION_H
 
 
+#include "arena.h"
+
 
 
 
@@ -17,17 +19,22 @@
 #define IF_TOKEN "if"
 #define DO_TOKEN "do"
 #define DONE_TOKEN "done"
+#define TIME_TOKEN "time"
 #define OR_TOKEN "||"
 #define AND_TOKEN "&&"
 #define BACK_TOKEN "&"
+#define PIPE_TOKEN "|"
 #define IF_SEP ";"
 #define REDIRECT_SEPERATOR ">"
 #define FAIL 'F'
 #define SUCCESS 'S'
 #define INVALID_INDEX -1
+#define PARSE_MAX_DEPTH 1000    // nested if statements and 'time's
 
 static const char * enumStrings[] = 
-    {"COMMAND", "IF_EXPRESSION", "OR_EXPRESSION", "AND_EXPRESSION"};
+    {"COMMAND", "IF_EXPRESSION", "OR_EXPRESSION", "AND_EXPRESSION",
+     "PIPE_EXPRESSION", "TIME_EXPRESSION"};
+
 
 
 
@@ -45,7 +52,28 @@ static const char * enumStrings[] =
  * Define different expression types that the 
  * Abstract Syntax Tree can have.
  * */
-typedef enum {COMMAND, IF_EXPRESSION, OR_EXPRESSION, AND_EXPRESSION} exp_type;
+typedef enum {COMMAND, IF_EXPRESSION, OR_EXPRESSION, AND_EXPRESSION,
+              PIPE_EXPRESSION, TIME_EXPRESSION} exp_type;
+
+
+/**
+ * Kind of every word of a command line, decided once by the lexer so the
+ * parser only has to compare integers.
+ * */
+typedef enum {TK_WORD, TK_IF, TK_DO, TK_DONE, TK_OR, TK_AND, TK_BACK,
+              TK_SEP, TK_REDIRECT, TK_PIPE, TK_TIME} token_kind;
+
+
+/**
+ * Entry of the keyword table: a token of the GLOBAL DEFINITIONS with its
+ * length, so most words are rejected without looking at their content.
+ * */
+typedef struct Keyword {
+    const char*     text;
+    size_t          len;
+    token_kind      kind;
+    bool            reserved;   // only a keyword at the start of a command
+} Keyword;
 
 
 /**
@@ -57,6 +85,7 @@ typedef struct Command {
     char**  cmd;            // a command
     bool    redirect_flag;  // if '>' exists
     char*   output_file;    // name of the file
+    char**  env;            // its "NAME=value" prefixes, or NULL
 } Command;
 
 
@@ -66,9 +95,10 @@ typedef struct Command {
  * the whole line as a background task.
  * */
 typedef struct Split_line {
-    int     size;           // size of the array
-    char**  content;        // array of words
-    bool    thread_flag;    // if '&' at the end
+    int             size;           // size of the array
+    char**          content;        // array of words
+    token_kind*     kinds;          // kind of each word
+    bool            thread_flag;    // if '&' at the end
 } Split_line;
 
 
@@ -88,6 +118,39 @@ typedef struct Expression {
 } Expression;
 
 
+/**
+ * Position of the parser in a command line. Every word is looked at once:
+ * the parser only moves forward, from `pos` up to `end`.
+ * */
+typedef struct Parser {
+    Split_line*     line;
+    int             pos;            // next word to read
+    int             end;            // last word that belongs to the range
+    int             depth;          // if statements and 'time's entered
+} Parser;
+
+
+/**
+ * Every keyword, built at compile-time from the GLOBAL DEFINITIONS.
+ * */
+#define KEYWORD(token, kind, reserved) \
+    {token, sizeof(token) - 1, kind, reserved}
+#define KEYWORD_MAX_LEN (sizeof(DONE_TOKEN) - 1)
+
+static const Keyword keywordTable[] = {
+    KEYWORD(IF_TOKEN,           TK_IF,          true),
+    KEYWORD(DO_TOKEN,           TK_DO,          true),
+    KEYWORD(DONE_TOKEN,         TK_DONE,        true),
+    KEYWORD(TIME_TOKEN,         TK_TIME,        true),
+    KEYWORD(OR_TOKEN,           TK_OR,          false),
+    KEYWORD(AND_TOKEN,          TK_AND,         false),
+    KEYWORD(BACK_TOKEN,         TK_BACK,        false),
+    KEYWORD(IF_SEP,             TK_SEP,         false),
+    KEYWORD(REDIRECT_SEPERATOR, TK_REDIRECT,    false),
+    KEYWORD(PIPE_TOKEN,         TK_PIPE,        false),
+};
+
+
 
 
 
@@ -97,18 +160,69 @@ typedef struct Expression {
 
 
 Expression* create_exp   (exp_type type, Expression* first, Expression* second);
-Expression* create_cmd   (char** line, int start_index, int end_index);
+Expression* create_cmd   (Split_line* line, int start_index, int end_index);
 Expression* parse_line   (Split_line* line, int start_index, int end_index);
+Expression* parse_list   (Parser* p);
+Expression* parse_pipeline(Parser* p);
+Expression* parse_term   (Parser* p);
+Expression* parse_if     (Parser* p);
+bool        parse_enter  (Parser* p);
+
+token_kind  classify_word  (const char* word, size_t len, token_kind previous);
+bool        starts_command (token_kind previous);
 
 int run_command          (Command* cmd);
+int run_pipeline         (Expression* exp);
+
+int eval                 (Expression* exp);  // see "bytecode.h"
 
-int eval                 (Expression* exp);
-int or_eval              (Expression* exp);
-int and_eval             (Expression* exp);
 
-void destroy_command     (Command* cmd);
-void destroy_expression  (Expression* e);
-void free_split_line     (Split_line* line);
+
+
+
+
+
+
+/* ********************************************************
+ * LEXING FUNCTIONS
+ * ***************************************************** */
+
+
+/**
+ * Tells if the word following a token of kind `previous` starts a new
+ * command, which is the only place where 'if', 'do', 'done' and 'time'
+ * are keywords (`echo if` prints "if"). The first word of a line is
+ * classified with `previous` set to TK_SEP.
+ * */
+bool starts_command (token_kind previous){
+    return previous != TK_WORD && previous != TK_REDIRECT
+        && previous != TK_BACK;
+}
+
+
+/**
+ * Gives the kind of a word of `len` characters. Only exact matches count:
+ * 'iffy' or '>>' are plain words.
+ * @param   previous    kind of the word before this one.
+ * */
+token_kind classify_word (const char* word, size_t len, token_kind previous){
+    if (len > KEYWORD_MAX_LEN){
+        return TK_WORD;
+    }
+
+    size_t count = sizeof(keywordTable) / sizeof(keywordTable[0]);
+    for (size_t k = 0; k < count; k++){
+        const Keyword* kw = &keywordTable[k];
+        if (kw->len == len && kw->text[0] == word[0]
+                && memcmp(kw->text, word, len) == 0){
+            if (kw->reserved && !starts_command(previous)){
+                return TK_WORD;
+            }
+            return kw->kind;
+        }
+    }
+    return TK_WORD;
+}
 
 
 
@@ -128,23 +242,30 @@ void free_split_line     (Split_line* line);
  * other useful information for executing the command.
  * @param   start_index     the index of the first word of the command to 
  *                          be created in the command line.
- * @param   end_index       the index of the first word of the command to 
+ * @param   end_index       the index of the last word of the command to 
  *                          be created in the command line.
- * @param   line            the array of words representing the command
- *                          to be created
+ * @param   line            the command line containing the words of
+ *                          the command to be created
  * @returns The Expression that represent the command to execute.
  * 
  * */ 
-Expression * create_cmd (char** line, int start_index, int end_index){
+Expression * create_cmd (Split_line* line, int start_index, int end_index){
+
+    char**       words = line->content;
+    token_kind*  kinds = line->kinds;
 
-    // correcting SIZE
+    // correcting SIZE : the ';' before a 'do' or a 'done' is not a word
+    if (end_index >= start_index && kinds[end_index] == TK_SEP){
+        end_index--;
+    }
     int size = end_index - start_index + 1;
-    if (strncmp(line[start_index + size - 1], IF_SEP, 1) == 0){
-        size--;
+    if (size <= 0){
+        printf("error in parsing : missing command\n");
+        return NULL;
     }
 
-    // ALLOCATING MEMORY
-    Expression* e = malloc(sizeof(Expression));
+    // ALLOCATING MEMORY (everything lives until the line arena is reset)
+    Expression* e = arena_alloc(&LINE_ARENA, sizeof(Expression));
     if (e == NULL){
         perror("malloc error create_cmd");
         return NULL;
@@ -152,373 +273,288 @@ Expression * create_cmd (char** line, int start_index, int end_index){
 
     e->id = COMMAND;
 
-    e->node.cmd_expr = malloc(sizeof(Command));
-    if (e->node.cmd_expr == NULL){
-        free(e);
+    Command* cmd = arena_alloc(&LINE_ARENA, sizeof(Command));
+    e->node.cmd_expr = cmd;
+    if (cmd == NULL){
         perror("malloc error create_cmd");
         return NULL;
     }
 
     // +1 for final NULL
-    e->node.cmd_expr->cmd = malloc(sizeof(char*) * (size + 1));
-    e->node.cmd_expr->redirect_flag=false;
+    cmd->cmd = arena_alloc(&LINE_ARENA, sizeof(char*) * (size + 1));
+    cmd->redirect_flag = false;
+    cmd->output_file = NULL;
+    cmd->env = NULL;
 
-    if (e->node.cmd_expr->cmd == NULL){
-        free(e->node.cmd_expr);
-        free(e);
+    if (cmd->cmd == NULL){
         perror("malloc error create_cmd");
         return NULL;
     }
 
-    // 
-    int i;
-    bool redir = false;
-    for(i = 0; i < size; i++){
-
-        // gérer le cas des multiples redirects
-        if (redir){
-            char * current = line[i + start_index]; 
-            char * next = line[i + start_index + 1];
-            if (strncmp(current, REDIRECT_SEPERATOR, 1) == 0 && 
-                (next == NULL 
-                || strncmp (next, OR_TOKEN, 2)   == 0
-                || strncmp (next, AND_TOKEN, 2)  == 0
-                || strncmp (next, DO_TOKEN, 2)   == 0
-                || strncmp (next, IF_TOKEN, 2)   == 0
-                || strncmp (next, DONE_TOKEN, 4) == 0
-                || next == IF_SEP
-                || next == REDIRECT_SEPERATOR)){
-                    printf("No output file. Redirect kept on %s.\n",
-                                                e->node.cmd_expr->output_file);
-                    return e;
-            } else {
-                if (strncmp(current, REDIRECT_SEPERATOR, 1)==0 && next != NULL){
-                    //printf("dest : %s\n", next);
-                    e->node.cmd_expr->output_file=next;
-                }
-            }
-        }       
-
-        // si on trouve un redirect
-        else if (strncmp(line[i+start_index], REDIRECT_SEPERATOR, 1) == 0){
-            redir = true;
-            char * next = line[i + start_index + 1];
-            
-            // if next word is NULL or a token => no redirect file
-            if (next == NULL 
-                || strncmp (next, OR_TOKEN, 2)  == 0
-                || strncmp (next, AND_TOKEN, 2) == 0
-                || strncmp (next, DO_TOKEN, 2)       == 0
-                || strncmp (next, IF_TOKEN, 2)       == 0
-                || strncmp (next, DONE_TOKEN, 4)     == 0
-                || next == IF_SEP
-                || next == REDIRECT_SEPERATOR){
-                    printf("No output file. Redirect on %s ignored\n",
-                                                            line[start_index]);
-                    // realloc a smaller memory 
-                    char ** tmp = realloc(e->node.cmd_expr->cmd, 
-                                                    (sizeof(char*) * (i + 1)));
-                    if (tmp == NULL){
-                        free(e->node.cmd_expr->cmd);
-                        return NULL;
-                    }
-                    e->node.cmd_expr->cmd = tmp;
-                    e->node.cmd_expr->cmd[i+1] = NULL;
-                    e->node.cmd_expr->redirect_flag=false;
-                    return e;
-                }
-               
-                // looks like 'command > my_file.txt'
-                e->node.cmd_expr->redirect_flag=true;
-                e->node.cmd_expr->output_file=next;
-
-                // realloc() free the old pointer, 
-                // but if it fails the old pointer is still OK
-                char ** tmp = realloc(e->node.cmd_expr->cmd, 
-                                                    (sizeof(char*) * (i + 1)));
-                    if (tmp == NULL){
-                        free(e->node.cmd_expr->cmd);
-                        return NULL;
-                    }
-                e->node.cmd_expr->cmd = tmp;
-                e->node.cmd_expr->cmd[i] = NULL;                
+    // the words before the first '>' are the arguments, and the word after
+    // the last '>' is the output file (anything else after a '>' is ignored)
+    int argc = 0;
+    for (int i = start_index; i <= end_index; i++){
+
+        if (kinds[i] != TK_REDIRECT){
+            if (!cmd->redirect_flag){
+                cmd->cmd[argc++] = words[i];
             }
+            continue;
+        }
 
-        else {
-            e->node.cmd_expr->cmd[i] = line[i + start_index];
+        // if next word is missing or a token => no redirect file
+        if (i == end_index || kinds[i + 1] != TK_WORD){
+            if (cmd->redirect_flag){
+                printf("No output file. Redirect kept on %s.\n",
+                                                            cmd->output_file);
+            } else {
+                printf("No output file. Redirect on %s ignored\n",
+                                                            words[start_index]);
+            }
+            break;
         }
+
+        // looks like 'command > my_file.txt'
+        cmd->redirect_flag = true;
+        cmd->output_file = words[++i];
     }
 
-    if (!redir){
-        e->node.cmd_expr->cmd[size] = NULL;
+    if (argc == 0){
+        printf("error in parsing : missing command\n");
+        return NULL;
     }
-    
+    cmd->cmd[argc] = NULL;
+
     return e;
 }
 
 
 
 /**
- * Creates nodes of the syntax tree based on what words are located whithin
- * the start_index and end_index.
+ * Creates the syntax tree of the words located whithin the start_index
+ * and end_index, in a single pass over them.
+ * 
+ * Grammar (the operators are right-associative and share the same
+ * priority: `a && b || c` runs as `a && (b || c)`):
+ *      list     :=  'time' list  |  pipeline [ ('&&' | '||') list ]
+ *      pipeline :=  term [ '|' pipeline ]
+ *      term     :=  'time' term  |  'if' list ';' 'do' list ';' 'done'
+ *                |  command
+ *
+ * A 'time' at the start of a chain times the rest of the chain; inside of
+ * a pipeline, it only times its stage.
  * 
  * @param   start_index     the index of the first word of the command line 
  *                          to parse
  * @param   end_index       the index of the last word of the command line 
  *                          to parse
- * @param   split_line      an array of word containing each individual 
- *                          statement (word seoerated by spaces) of 
- *                          the command line
- * @return  an Expression representation of the commad to execute. It is
- *          a single node in the Abstract Syntax Tree that is created. 
+ * @param   split_line      the words of the command line, along with the
+ *                          kind the lexer gave to each of them
+ * @return  an Expression representation of the commad to execute: the root
+ *          of the Abstract Syntax Tree that is created, or NULL if the
+ *          line is not valid.
  * 
  * */
 Expression * parse_line (Split_line* line, int start_index, int end_index) {
 
-    // printf("parsing line from %d to %d\n", start_index, end_index);
-
-    if (start_index<0||end_index<0){
+    if (start_index < 0 || end_index < start_index){
+        printf("error in parsing : missing command\n");
         return NULL;
     }
 
-    int if_count = 0;
-    int do_count = 0;
-    int done_count = 0;
+    // a trailing ';' is allowed
+    if (line->kinds[end_index] == TK_SEP && end_index > start_index){
+        end_index--;
+    }
 
-    // look for the root of the AST : either the first if statement,
-    // or the first logical operator outside an if statement
-    for (int i = start_index; i < end_index; ++i) {
+    Parser p = {line, start_index, end_index, 0};
+    Expression* root = parse_list(&p);
 
-        char* current = line->content[i];
+    // only a stray 'do', 'done' or ';' can stop the parser before the end
+    if (root != NULL && p.pos <= p.end){
+        printf("error in parsing if statement\n");
+        return NULL;
+    }
+    return root;
+}
 
-        // counting if
-        if (strncmp(current, IF_TOKEN, 2) == 0){
-            if (i == start_index){
-                    if_count++;
-            } else {
-                char* previous = line->content[i - 1];
-                if (strncmp(previous, IF_TOKEN, 2) == 0  || 
-                    strncmp(previous, DO_TOKEN, 2) == 0  || 
-                    strncmp(previous, AND_TOKEN, 2) == 0 || 
-                    strncmp(previous, OR_TOKEN, 2) == 0) {
-                    if_count++;
-                }
-            }
-        }
 
-        // counting do
-        if (strncmp(current, DO_TOKEN, 2) == 0 && 
-            strncmp(current, DONE_TOKEN, 4) != 0){
-            // todo : check if it is a true 'do'
-            if (i != start_index 
-                && strncmp(line->content[i-1], IF_SEP, 1) == 0){
-                do_count++;
-            }
+/**
+ * Parses a chain of pipelines joined by '&&' and '||'. The chain is built
+ * without recursion, however long it is: each operator node is hooked
+ * to the `right` of the previous one.
+ * */
+Expression * parse_list (Parser* p){
+
+    Expression*  root = NULL;
+    Expression** hole = &root;  // where the next term goes
+
+    while (true){
+        if (p->pos <= p->end && p->line->kinds[p->pos] == TK_TIME){
+            p->pos++;  // skip the 'time'
+            Expression* rest = parse_enter(p) ? parse_list(p) : NULL;
+            *hole = rest == NULL ? NULL
+                                 : create_exp(TIME_EXPRESSION, rest, NULL);
+            p->depth--;
+            return *hole == NULL ? NULL : root;
         }
 
-
-        // counting done
-        if (strncmp(current, DO_TOKEN, 2) == 0 && 
-            strlen(current) == 2 &&
-            strncmp(line->content[i-1], IF_SEP, 1) == 0) {
-            done_count++;
+        Expression* term = parse_pipeline(p);
+        if (term == NULL){
+            return NULL;
         }
 
-
-        // outside of an if statement implies if_count == done_count
-
-        // the 'and' token at 'i' is the root
-        if (strncmp(current, AND_TOKEN, 3) == 0 && if_count == done_count){
-            // printf("the \'AND\' token at %d is the root\n", i);
-            Expression* left = parse_line(line, start_index, i - 1);
-            if (left == NULL){
-                return NULL;
-            }
-            Expression* right = parse_line(line, i+1, end_index);
-            if (right == NULL){
-                destroy_expression(left);
-                return NULL;
-            } else {
-                return create_exp(AND_EXPRESSION, left, right);
-            }
+        token_kind next = (p->pos <= p->end) ? p->line->kinds[p->pos]
+                                             : TK_SEP;
+        if (next != TK_AND && next != TK_OR){
+            *hole = term;
+            return root;
         }
 
-        // the 'or' token at 'i' is the root
-        if (strncmp(current, OR_TOKEN, 2) == 0 && if_count == done_count){
-            // printf("the \'OR\' token at %d is the root\n", i);
-            Expression* left = parse_line(line, start_index, i - 1);
-            if (left == NULL){
-                return NULL;
-            }
-            Expression* right = parse_line(line, i+1, end_index);
-            if (right == NULL){
-                destroy_expression(left);
-                return NULL;
-            } else {
-                return create_exp(OR_EXPRESSION, left, right);
-            }
-
+        Expression* e = create_exp(next == TK_AND ? AND_EXPRESSION
+                                                  : OR_EXPRESSION,
+                                   term, NULL);
+        if (e == NULL){
+            return NULL;
         }
-
-    }
-
-    // error if statement
-    if ((if_count != 0 || do_count != 0 || done_count != 0) && 
-        ((if_count != do_count) || (if_count != done_count))){
-        printf("error in parsing if statement\n");
-        return NULL;
+        *hole = e;
+        hole = &e->node.cond_expr.right;
+        p->pos++;  // skip the operator
     }
+}
 
-    // here, the root of the AST is the 'if' statement at the beginning of the
-    if (if_count != 0 && if_count == done_count){
-
-        // inside an if statement.
-        // Need to separate the 'if' and 'do' statements
-        if_count = 0;
-        do_count = 0;
-        done_count = 0;
-
-        int do_index = INVALID_INDEX;
-        int done_index = INVALID_INDEX;
-        bool do_found = false;
-
-        for (int j = start_index; j <= end_index; ++j){
-
-            char* current = line->content[j];
-            // printf("checking for ifs [%s]\n", current);
-            if (strncmp(current, IF_TOKEN, 2) == 0 &&
-                strlen(current) == 2){
-                if_count++;
-            }
-
-            if (strncmp(current, DO_TOKEN, 2) == 0 && 
-                strlen(current) == 2 &&
-                strncmp(line->content[j-1], IF_SEP, 1) == 0
-                ){
-                do_count++;
-            }
-
-            if (strncmp(current, DONE_TOKEN, 4) == 0 &&
-                strlen(current) == 4 &&
-                strncmp(line->content[j-1], IF_SEP, 1) == 0){
-                done_count++;
-            }
 
-            if (if_count == do_count && !do_found){
-                do_index = j;
-                do_found = true;
-            }
+/**
+ * Parses terms joined by '|', hooked to one another like in `parse_list()`:
+ * `a | b | c` gives PIPE(a, PIPE(b, c)). A single term is returned as is.
+ * */
+Expression * parse_pipeline (Parser* p){
 
-            if (if_count == done_count){
-                done_index = j;
-            }
+    Expression*  root = NULL;
+    Expression** hole = &root;
 
+    while (true){
+        Expression* term = parse_term(p);
+        if (term == NULL){
+            return NULL;
         }
 
-        // if :
-        Expression *condition = parse_line(line, start_index + 1, do_index - 1);
-        if (condition==NULL){
-            return NULL;
+        if (p->pos > p->end || p->line->kinds[p->pos] != TK_PIPE){
+            *hole = term;
+            return root;
         }
 
-        Expression *statement = parse_line(line, do_index +1, done_index - 1);
-        if (statement == NULL){
-            destroy_expression(condition);
+        Expression* e = create_exp(PIPE_EXPRESSION, term, NULL);
+        if (e == NULL){
             return NULL;
         }
-
-        return create_exp(IF_EXPRESSION, condition, statement);
-    }
-
-    // there is no 'if' statement, nor logical operator. 
-    // The commnad line is a single command.
-    if (if_count == 0){
-        return create_cmd(line->content, start_index, end_index);
+        *hole = e;
+        hole = &e->node.cond_expr.right;
+        p->pos++;  // skip the '|'
     }
-
-    // error in parsing
-    printf("error in parsing \n");
-    return NULL;
-
 }
 
 
+/**
+ * Parses either an if statement or a single command. A command goes on
+ * until an operator, or a ';' that ends the line or precedes a 'do' or a
+ * 'done' (any other ';' is kept as an argument).
+ * */
+Expression * parse_term (Parser* p){
 
+    token_kind* kinds = p->line->kinds;
 
+    if (p->pos <= p->end && kinds[p->pos] == TK_IF){
+        return parse_if(p);
+    }
+    if (p->pos <= p->end && kinds[p->pos] == TK_TIME){
+        p->pos++;  // skip the 'time'
+        Expression* term = parse_enter(p) ? parse_term(p) : NULL;
+        p->depth--;
+        return term == NULL ? NULL : create_exp(TIME_EXPRESSION, term, NULL);
+    }
 
+    int start = p->pos;
+    for (; p->pos <= p->end; p->pos++){
+        token_kind k = kinds[p->pos];
+        if (k == TK_AND || k == TK_OR || k == TK_PIPE
+                || k == TK_DO || k == TK_DONE){
+            break;
+        }
+        if (k == TK_SEP && (p->pos == p->end || kinds[p->pos + 1] == TK_DO
+                                             || kinds[p->pos + 1] == TK_DONE)){
+            break;
+        }
+    }
 
-
-
-
-/* ********************************************************
- * EVALUATION FUNCTIONS
- * ***************************************************** */
+    if (p->pos == start){
+        if (p->pos <= p->end && kinds[p->pos] != TK_AND
+                             && kinds[p->pos] != TK_OR
+                             && kinds[p->pos] != TK_PIPE){
+            printf("error in parsing if statement\n");
+        } else {
+            printf("error in parsing : missing command\n");
+        }
+        return NULL;
+    }
+    return create_cmd(p->line, start, p->pos - 1);
+}
 
 
 /**
- * The entry point for evaluating a node of the Abstract Syntax Tree.
- * This function should be called with the root of the tree to evaluate
- * every node in the correct order.
- * 
- * Four different type of expression are used to evaluate the tree as defined
- * in the exp_type enum. Every enum item has it's own way to be evaluated
- * correctly. IF_EXPRESSION is directly evaluated here, wheras 
- * OR_EXPRESSION and AND_EXPRESSION have their own methods. COMMAND enum type
- * also has it's own command run_command(command *) to execute a single
- * command.
- * 
- * @param   exp     the node of the AST to evaluate.
- * @return  int     a boolean representing if the evaluation 
- *                  has succeeded or not.
- * 
+ * Parses `if list ; do list ; done`, starting on the 'if'.
  * */
-int eval (Expression* exp){
-  if (exp == NULL){
-    return false;
-  }
-  
-  switch (exp->id){
-      case IF_EXPRESSION :
-          if (eval(exp->node.cond_expr.left)){
-              return eval(exp->node.cond_expr.right);
-          } else {
-              // failure of the conditional statement is considered a 
-              // successful if statement
-              return true; // success
-          }
-      case COMMAND:            return run_command(exp->node.cmd_expr);
-      case OR_EXPRESSION:      return or_eval(exp);
-      case AND_EXPRESSION:     return and_eval(exp);
-      default:                 return -1;
-  }
-}
+Expression * parse_if (Parser* p){
 
+    token_kind* kinds = p->line->kinds;
+    p->pos++;  // skip the 'if'
+    if (!parse_enter(p)){
+        return NULL;
+    }
 
-/**
- * Evaluation procedure for an IF_EXPRESSION exp_type enum instance.
- * 
- * */
-int or_eval (Expression* exp){
-    int first_result = eval(exp->node.cond_expr.left);
-    if (first_result){
-        return first_result;
-    } else {
-        return eval(exp->node.cond_expr.right);
+    // if :
+    Expression *condition = parse_list(p);
+    if (condition == NULL){
+        return NULL;
+    }
+    if (p->pos + 1 > p->end || kinds[p->pos] != TK_SEP
+                            || kinds[p->pos + 1] != TK_DO){
+        printf("error in parsing if statement\n");
+        return NULL;
     }
+    p->pos += 2;  // skip '; do'
+
+    Expression *statement = parse_list(p);
+    if (statement == NULL){
+        return NULL;
+    }
+    if (p->pos + 1 > p->end || kinds[p->pos] != TK_SEP
+                            || kinds[p->pos + 1] != TK_DONE){
+        printf("error in parsing if statement\n");
+        return NULL;
+    }
+    p->pos += 2;  // skip '; done'
+
+    p->depth--;
+    return create_exp(IF_EXPRESSION, condition, statement);
 }
 
 
 /**
- * Evaluation procedure for an AND_EXPRESSION exp_type enum instance.
- * 
+ * Goes one if statement or 'time' deeper. The parser, like the copies of
+ * the tree, recurses at each level: a line nested deeper than
+ * PARSE_MAX_DEPTH is refused rather than risking the end of the stack.
+ * The caller goes back up with `p->depth--` once the level is parsed.
+ * @return  false if the line is nested too deep.
  * */
-int and_eval (Expression* exp){
-    int first_result = eval(exp->node.cond_expr.left);
-    if (first_result){
-        return eval(exp->node.cond_expr.right);
-    } else {
+bool parse_enter (Parser* p){
+    if (++p->depth > PARSE_MAX_DEPTH){
+        printf("error in parsing : more than %d nested statements\n",
+               PARSE_MAX_DEPTH);
         return false;
     }
+    return true;
 }
 
 
@@ -528,14 +564,20 @@ int and_eval (Expression* exp){
 
 
 
+
 /* ***********************************************************
  * MEMORY MANAGEMENT 
  * *********************************************************** */
 
 
+/**
+ * Creates an inner node of the syntax tree. Like every other parse-time
+ * object, it is allocated in the LINE_ARENA: there is no destructor, the
+ * whole tree goes away when the arena is reset.
+ * */
 Expression * create_exp (exp_type type, Expression* first, Expression* second){
 
-    Expression* e = malloc(sizeof(Expression));
+    Expression* e = arena_alloc(&LINE_ARENA, sizeof(Expression));
     if (e == NULL){
         perror("malloc error create_exp");
         return NULL;
@@ -548,42 +590,4 @@ Expression * create_exp (exp_type type, Expression* first, Expression* second){
 
 }
 
-
-void destroy_expression (Expression* e){
-
-    // printf("freeing %s\n\n", enumStrings[e->id]);
-
-    if (e==NULL){
-        return;
-    }
-
-    if (e->id == COMMAND){
-        destroy_command(e->node.cmd_expr);
-    }
-
-    else {
-        destroy_expression(e->node.cond_expr.left);
-        destroy_expression(e->node.cond_expr.right);
-    }
-
-    free(e);
-
-}
-
-
-void destroy_command(Command* cmd_expr){
-    free(cmd_expr->cmd);
-    free(cmd_expr);
-}
-
-
-void free_split_line(Split_line* line) {
-    for(int i = 0; i < line->size; i++) {
-        if(line->content[i] != NULL)
-            free(line->content[i]);
-    }
-    free(line->content);
-    free(line);
-}
-
 #endif //TESTSHELL_EXPRESSION_H
@@ -0,0 +1,491 @@
+#ifndef TESTSHELL_FORK_SERVER_H
+#define TESTSHELL_FORK_SERVER_H
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define FORK_SERVER_FDS 4   // stdin, stdout, stderr, working directory
+#define FORK_SERVER_STACK (64 * 1024)  // of the children, until their exec
+
+
+/**
+ * What the shell sends for every command, followed by `size` bytes: the
+ * path of the file, the `argc` words and the `envc` variables of the
+ * environment, each ended by a '\0', then the '>' file if `redirect`.
+ * The descriptors of the child come with it, as SCM_RIGHTS.
+ * */
+typedef struct Fork_request {
+    uint32_t        size;
+    uint32_t        argc;
+    uint32_t        envc;
+    uint32_t        redirect;
+    uint32_t        quiet;      // Ctrl-C and Ctrl-\ are ignored (background)
+} Fork_request;
+
+
+/**
+ * What the server answers: the PID of the child, or -1 if it could not
+ * create one. `error` is set when the child could not exec.
+ * */
+typedef struct Fork_reply {
+    pid_t           pid;
+    int             error;
+} Fork_reply;
+
+
+/**
+ * A request being started by the server, shared with the child.
+ * */
+typedef struct Fork_job {
+    char*           path;
+    char**          argv;
+    char**          envp;
+    const char*     output;     // the '>' file, or NULL
+    const int*      fds;
+    bool            quiet;      // see Fork_request
+    volatile int    error;      // why the exec failed
+} Fork_job;
+
+
+/**
+ * The helper forked at start-up while the shell is still small. Its
+ * children are created with CLONE_PARENT: they are children of the shell
+ * itself, which waits for them and gets their SIGCHLD like for any other
+ * engine. Only the process that started the server may use it.
+ * */
+typedef struct Fork_server {
+    pid_t           pid;
+    pid_t           owner;
+    int             sock;       // -1 when there is no server
+    char*           buffer;     // requests being built or read
+    size_t          capacity;
+    char**          words;      // argv and envp, in the server
+    size_t          words_capacity;
+    char*           stack;      // of the children, in the server
+} Fork_server;
+
+
+Fork_server FORK_SERVER = {0, 0, -1, NULL, 0, NULL, 0, NULL};
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+bool       fork_server_start    ();
+void       fork_server_stop     ();
+bool       fork_server_reserve  (size_t size);
+bool       fork_server_pack     (Command* cmd, const char* path,
+                                 char** envp, Fork_request* request);
+bool       fork_server_send     (const Fork_request* request,
+                                 const int fds[FORK_SERVER_FDS]);
+void       fork_server_loop     (int sock);
+Fork_reply fork_server_spawn    (const Fork_request* request,
+                                 const int fds[FORK_SERVER_FDS]);
+int        fork_server_child    (void* arg);
+bool       read_full            (int fd, void* buffer, size_t size);
+bool       send_full            (int fd, const void* buffer, size_t size);
+
+
+
+
+/* ********************************************************
+ * SHELL SIDE
+ * ****************************************************** */
+
+
+/**
+ * Forks the server. Called once, before the shell has grown.
+ * @return  false if it could not be started.
+ * */
+bool fork_server_start (){
+    int sv[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv) < 0){
+        return false;
+    }
+
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0){  // the server
+        close(sv[0]);
+        fork_server_loop(sv[1]);
+    }
+    close(sv[1]);
+    if (pid < 0){
+        close(sv[0]);
+        return false;
+    }
+
+    FORK_SERVER.pid = pid;
+    FORK_SERVER.owner = getpid();
+    FORK_SERVER.sock = sv[0];
+    return true;
+}
+
+
+/**
+ * Closes the socket: the server exits when it reads the end of it.
+ * */
+void fork_server_stop (){
+    if (FORK_SERVER.sock >= 0){
+        close(FORK_SERVER.sock);
+        FORK_SERVER.sock = -1;
+    }
+    free(FORK_SERVER.buffer);
+    FORK_SERVER.buffer = NULL;
+    FORK_SERVER.capacity = 0;
+}
+
+
+/**
+ * Fork-server engine: the server creates the child from its own small
+ * address space, so the cost does not grow with the shell. The forked
+ * copies of the shell use posix_spawn instead, as does the shell once
+ * the server is gone.
+ * */
+pid_t spawn_with_server (Command* cmd, const char* path, char** envp,
+                         int fd_in, int fd_out){
+    if (FORK_SERVER.sock < 0 || FORK_SERVER.owner != getpid()){
+        return spawn_with_posix(cmd, path, envp, fd_in, fd_out);
+    }
+
+    Fork_request request;
+    if (!fork_server_pack(cmd, path, envp, &request)){
+        return -1;
+    }
+    struct sigaction interrupt;  // what the other engines would pass on
+    sigaction(SIGINT, NULL, &interrupt);
+    request.quiet = interrupt.sa_handler == SIG_IGN;
+    int fds[FORK_SERVER_FDS] = {fd_in >= 0 ? fd_in : STDIN_FILENO,
+                                fd_out >= 0 ? fd_out : STDOUT_FILENO,
+                                STDERR_FILENO,
+                                open(".", O_PATH | O_DIRECTORY | O_CLOEXEC)};
+    if (fds[3] < 0){
+        return -1;
+    }
+
+    Fork_reply reply;
+    bool sent = fork_server_send(&request, fds)
+                && read_full(FORK_SERVER.sock, &reply, sizeof(reply));
+    close(fds[3]);
+    if (!sent){
+        fprintf(stderr, "fork server lost: using posix_spawn\n");
+        fork_server_stop();
+        return spawn_with_posix(cmd, path, envp, fd_in, fd_out);
+    }
+
+    if (reply.pid > 0 && reply.error != 0){
+        waitpid(reply.pid, NULL, 0);  // our child: nothing left to wait for
+        SPAWN_ERROR = reply.error;
+        return -1;
+    }
+    return reply.pid;
+}
+
+
+/**
+ * Makes room for `size` bytes in the buffer of the requests.
+ * */
+bool fork_server_reserve (size_t size){
+    if (size <= FORK_SERVER.capacity){
+        return true;
+    }
+    size_t capacity = FORK_SERVER.capacity ? FORK_SERVER.capacity : 4096;
+    while (capacity < size){
+        capacity *= 2;
+    }
+    char* buffer = realloc(FORK_SERVER.buffer, capacity);
+    if (buffer == NULL){
+        return false;
+    }
+    FORK_SERVER.buffer = buffer;
+    FORK_SERVER.capacity = capacity;
+    return true;
+}
+
+
+/**
+ * Writes the strings of a request in the buffer.
+ * */
+bool fork_server_pack (Command* cmd, const char* path, char** envp,
+                       Fork_request* request){
+    memset(request, 0, sizeof(*request));
+    size_t size = strlen(path) + 1;
+    for (char** w = cmd->cmd; *w != NULL; w++){
+        size += strlen(*w) + 1;
+        request->argc++;
+    }
+    for (char** e = envp; *e != NULL; e++){
+        size += strlen(*e) + 1;
+        request->envc++;
+    }
+    if (cmd->redirect_flag){
+        size += strlen(cmd->output_file) + 1;
+        request->redirect = 1;
+    }
+    if (size > UINT32_MAX || !fork_server_reserve(size)){
+        return false;
+    }
+    request->size = (uint32_t) size;
+
+    char* out = FORK_SERVER.buffer;
+    out = stpcpy(out, path) + 1;
+    for (char** w = cmd->cmd; *w != NULL; w++){
+        out = stpcpy(out, *w) + 1;
+    }
+    for (char** e = envp; *e != NULL; e++){
+        out = stpcpy(out, *e) + 1;
+    }
+    if (cmd->redirect_flag){
+        stpcpy(out, cmd->output_file);
+    }
+    return true;
+}
+
+
+/**
+ * Sends a request and its descriptors, in as few calls as possible.
+ * */
+bool fork_server_send (const Fork_request* request,
+                       const int fds[FORK_SERVER_FDS]){
+    union {
+        char            data[CMSG_SPACE(sizeof(int) * FORK_SERVER_FDS)];
+        struct cmsghdr  align;
+    } control;
+    struct iovec iov[2] = {
+        {(void*) request, sizeof(*request)},
+        {FORK_SERVER.buffer, request->size},
+    };
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = 2;
+    msg.msg_control = control.data;
+    msg.msg_controllen = sizeof(control.data);
+
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int) * FORK_SERVER_FDS);
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(int) * FORK_SERVER_FDS);
+
+    ssize_t sent;
+    do {
+        sent = sendmsg(FORK_SERVER.sock, &msg, MSG_NOSIGNAL);
+    } while (sent < 0 && errno == EINTR);
+    if (sent < (ssize_t) sizeof(*request)){
+        return false;
+    }
+    size_t done = (size_t) sent - sizeof(*request);  // the rest of a big one
+    return send_full(FORK_SERVER.sock, FORK_SERVER.buffer + done,
+                      request->size - done);
+}
+
+
+
+
+/* ********************************************************
+ * SERVER SIDE
+ * ****************************************************** */
+
+
+/**
+ * Body of the server: answers the requests one by one, until the shell
+ * closes the socket. Ignores Ctrl-Z, like the children it creates, and
+ * blocks Ctrl-C, which is only for them: it outlives the foreground
+ * command just like the shell (its children start with none blocked).
+ * */
+void fork_server_loop (int sock){
+    struct sigaction ignore;
+    ignore.sa_handler = SIG_IGN;
+    sigemptyset(&ignore.sa_mask);
+    ignore.sa_flags = 0;
+    sigaction(SIGTSTP, &ignore, NULL);
+
+    sigset_t interrupt;
+    sigemptyset(&interrupt);
+    sigaddset(&interrupt, SIGINT);
+    sigprocmask(SIG_BLOCK, &interrupt, NULL);
+
+    while (true){
+        Fork_request request;
+        int          fds[FORK_SERVER_FDS];
+        union {
+            char            data[CMSG_SPACE(sizeof(int) * FORK_SERVER_FDS)];
+            struct cmsghdr  align;
+        } control;
+        struct iovec  iov = {&request, sizeof(request)};
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control.data;
+        msg.msg_controllen = sizeof(control.data);
+
+        ssize_t got = recvmsg(sock, &msg, MSG_WAITALL | MSG_CMSG_CLOEXEC);
+        struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        if (got != (ssize_t) sizeof(request) || cmsg == NULL
+                || cmsg->cmsg_type != SCM_RIGHTS
+                || cmsg->cmsg_len != CMSG_LEN(sizeof(fds))){
+            _exit(EXIT_SUCCESS);  // the shell is gone
+        }
+        memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+
+        Fork_reply reply = {-1, 0};
+        if (fork_server_reserve(request.size)
+                && read_full(sock, FORK_SERVER.buffer, request.size)){
+            reply = fork_server_spawn(&request, fds);
+        }
+        for (int i = 0; i < FORK_SERVER_FDS; i++){
+            close(fds[i]);
+        }
+        if (!send_full(sock, &reply, sizeof(reply))){
+            _exit(EXIT_SUCCESS);
+        }
+    }
+}
+
+
+/**
+ * Creates the child of a request, as a child of the shell. Like vfork,
+ * the child borrows the memory of the server (on a stack of its own) and
+ * the server waits until it has called exec, so a failed exec is seen in
+ * `job.error`.
+ * */
+Fork_reply fork_server_spawn (const Fork_request* request,
+                              const int fds[FORK_SERVER_FDS]){
+    Fork_reply reply = {-1, 0};
+    size_t     count = request->argc + request->envc + 2;
+    if (count > FORK_SERVER.words_capacity){
+        char** words = realloc(FORK_SERVER.words, count * sizeof(char*));
+        if (words == NULL){
+            return reply;
+        }
+        FORK_SERVER.words = words;
+        FORK_SERVER.words_capacity = count;
+    }
+    if (FORK_SERVER.stack == NULL
+            && (FORK_SERVER.stack = malloc(FORK_SERVER_STACK)) == NULL){
+        return reply;
+    }
+
+    /* The strings are already in place: only the arrays are built. */
+    Fork_job job;
+    char*    str = FORK_SERVER.buffer;
+    job.path = str;
+    job.argv = FORK_SERVER.words;
+    job.envp = job.argv + request->argc + 1;
+    str += strlen(str) + 1;
+    for (uint32_t i = 0; i < request->argc; i++){
+        job.argv[i] = str;
+        str += strlen(str) + 1;
+    }
+    job.argv[request->argc] = NULL;
+    for (uint32_t i = 0; i < request->envc; i++){
+        job.envp[i] = str;
+        str += strlen(str) + 1;
+    }
+    job.envp[request->envc] = NULL;
+    job.output = request->redirect ? str : NULL;
+    job.fds = fds;
+    job.quiet = request->quiet != 0;
+    job.error = 0;
+
+    pid_t pid = clone(fork_server_child, FORK_SERVER.stack + FORK_SERVER_STACK,
+                      CLONE_PARENT | CLONE_VM | CLONE_VFORK | SIGCHLD, &job);
+    reply.pid = pid < 0 ? -1 : pid;
+    reply.error = pid < 0 ? 0 : job.error;
+    return reply;
+}
+
+
+/**
+ * First function of a child: plugs its descriptors, goes to the directory
+ * of the shell and executes the command. Only async-signal-safe calls.
+ * A background child ignores Ctrl-C and Ctrl-\, as it would have from the
+ * shell with another engine.
+ * */
+int fork_server_child (void* arg){
+    Fork_job* job = arg;
+    if (job->quiet){
+        struct sigaction ignore;
+        ignore.sa_handler = SIG_IGN;
+        sigemptyset(&ignore.sa_mask);
+        ignore.sa_flags = 0;
+        sigaction(SIGINT, &ignore, NULL);
+        sigaction(SIGQUIT, &ignore, NULL);
+    }
+    sigset_t  none;
+    sigemptyset(&none);
+    sigprocmask(SIG_SETMASK, &none, NULL);
+
+    bool plugged = true;
+    for (int i = 0; i < 3 && plugged; i++){
+        plugged = job->fds[i] == i || dup2(job->fds[i], i) >= 0;
+    }
+    if (plugged && fchdir(job->fds[3]) == 0){
+        int file = job->output == NULL ? -1
+                 : open(job->output, REDIRECT_FLAGS, REDIRECT_MODE);
+        if (job->output == NULL || (file >= 0 && dup2(file, 1) >= 0
+                                              && close(file) == 0)){
+            execve(job->path, job->argv, job->envp);
+        }
+    }
+    job->error = errno;
+    _exit(FAILED_EXECVP);
+}
+
+
+bool read_full (int fd, void* buffer, size_t size){
+    char* at = buffer;
+    while (size > 0){
+        ssize_t got = read(fd, at, size);
+        if (got < 0 && errno == EINTR){
+            continue;
+        }
+        if (got <= 0){
+            return false;
+        }
+        at += got;
+        size -= (size_t) got;
+    }
+    return true;
+}
+
+
+bool send_full (int fd, const void* buffer, size_t size){
+    const char* at = buffer;
+    while (size > 0){
+        ssize_t sent = send(fd, at, size, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR){
+            continue;
+        }
+        if (sent <= 0){
+            return false;
+        }
+        at += sent;
+        size -= (size_t) sent;
+    }
+    return true;
+}
+
+
+#endif //TESTSHELL_FORK_SERVER_H
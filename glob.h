@@ -0,0 +1,725 @@
+#ifndef TESTSHELL_GLOB_H
+#define TESTSHELL_GLOB_H
+
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <fnmatch.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+#include "arena.h"
+#include "expression.h"
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define GLOB_CHARS "*?["
+#define GLOB_ESCAPE '\\'
+#define GLOB_STAR "**"
+#define GLOB_READ_SIZE (256 * 1024)     // bytes asked of `getdents64()`
+#define GLOB_CACHE_BUCKETS 64
+#define GLOB_MIN_CAPACITY 64
+#ifndef FNV_OFFSET
+#define FNV_OFFSET 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+#endif
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * An entry as `getdents64()` writes it.
+ * */
+typedef struct Glob_dirent {
+    uint64_t            ino;
+    int64_t             off;
+    unsigned short      reclen;
+    unsigned char       type;
+    char                name[];
+} Glob_dirent;
+
+
+/**
+ * The entries of a directory, but "." and "..", in the order the kernel
+ * gave them. Everything is in the LINE_ARENA; a directory that cannot be
+ * read has no entry.
+ * */
+typedef struct Glob_dir {
+    struct Glob_dir*    next;       // in the same bucket
+    uint64_t            hash;
+    const char*         path;       // as it appears in the pattern
+    char**              names;
+    unsigned char*      types;      // DT_ values, DT_UNKNOWN when not known
+    size_t              count;
+} Glob_dir;
+
+
+/**
+ * The expansion of the words of one command. The directories read are
+ * cached for the other words of the command, and forgotten before the
+ * next one, which may run after something changed them. The buffers are
+ * kept from one command to the next.
+ * */
+typedef struct Glob {
+    Glob_dir*           buckets[GLOB_CACHE_BUCKETS];
+    bool                cached;     // a bucket is not empty
+    char*               dirents;    // GLOB_READ_SIZE bytes
+    char**              names;      // entries of the directory being read
+    unsigned char*      types;
+    size_t              names_capacity;
+    char*               pattern;    // the word, '/' replaced by '\0'
+    size_t              pattern_capacity;
+    const char**        parts;      // its components
+    size_t              parts_capacity;
+    size_t              part_count;
+    bool                dir_only;   // the word ends with '/'
+    char*               path;       // where the walk is
+    size_t              path_len;
+    size_t              path_capacity;
+    char*               text;       // the matches, one after the other
+    size_t              text_len;
+    size_t              text_capacity;
+    size_t*             matches;    // where each one starts in `text`
+    size_t              match_count;
+    size_t              match_capacity;
+    bool                failed;     // out of memory
+} Glob;
+
+
+Glob GLOB;
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+Command*    glob_command        (Command* cmd);
+bool        glob_word           (Glob* g, const char* word);
+bool        glob_literal_word   (Glob* g, const char* word);
+void        glob_walk           (Glob* g, size_t part);
+void        glob_star           (Glob* g, size_t part);
+void        glob_emit           (Glob* g, const char* name, bool slash);
+bool        glob_is_dir         (Glob* g, const Glob_dir* dir, size_t i,
+                                 bool follow);
+bool        glob_push           (Glob* g, const char* str, size_t len);
+bool        glob_push_literal   (Glob* g, const char* part);
+Glob_dir*   glob_list           (Glob* g);
+bool        glob_read_dir       (Glob* g, int fd, Glob_dir* dir);
+void        glob_forget         (Glob* g);
+void        glob_free           (Glob* g);
+bool        has_glob            (const char* word);
+bool        has_escape          (const char* word);
+bool        is_escape           (const char* c);
+bool        is_literal_part     (const char* part);
+bool        grow_array          (void** array, size_t* capacity,
+                                 size_t needed, size_t item);
+int         compare_strings     (const void* a, const void* b);
+
+
+
+
+/* ********************************************************
+ * EXPANSION
+ * ****************************************************** */
+
+
+/**
+ * Replaces the words of `cmd` that contain '*', '?' or '[' by the paths
+ * they match, sorted, like sh does. "**" matches any number of
+ * directories (symbolic links to directories are not followed there).
+ * Names starting with '.' are only matched by a '.'. A word that matches
+ * nothing is kept as it is. A '\' before one of these characters makes it
+ * literal, and is removed from the word. The words of the tree are not
+ * modified: the new ones are in the LINE_ARENA, the matched paths in a
+ * single block.
+ * @return  `cmd` itself if nothing had to be expanded, NULL if memory
+ *          is lacking.
+ * */
+Command* glob_command (Command* cmd){
+    int argc = 0;
+    int patterns = 0;
+    for (; cmd->cmd[argc] != NULL; argc++){
+        patterns += has_glob(cmd->cmd[argc]) || has_escape(cmd->cmd[argc]);
+    }
+    if (patterns == 0){
+        return cmd;
+    }
+
+    Glob* g = &GLOB;
+    glob_forget(g);
+    g->text_len = 0;
+    g->match_count = 0;
+    g->failed = false;
+
+    size_t* first = arena_alloc(&LINE_ARENA, (argc + 1) * sizeof(size_t));
+    if (first == NULL){
+        return NULL;
+    }
+    for (int i = 0; i < argc; i++){
+        const char* word = cmd->cmd[i];
+        first[i] = g->match_count;
+        if (has_glob(word) && !glob_word(g, word)){
+            return NULL;
+        }
+        if (g->match_count == first[i] && has_escape(word)
+                && !glob_literal_word(g, word)){
+            return NULL;
+        }
+    }
+    first[argc] = g->match_count;
+
+    /* The matches go in the arena at once, then into their words. */
+    size_t total = 0;
+    for (int i = 0; i < argc; i++){
+        total += first[i + 1] > first[i] ? first[i + 1] - first[i] : 1;
+    }
+    Command* expanded = arena_alloc(&LINE_ARENA, sizeof(Command));
+    char**   words = arena_alloc(&LINE_ARENA, (total + 1) * sizeof(char*));
+    char*    text = arena_alloc(&LINE_ARENA, g->text_len + 1);
+    if (expanded == NULL || words == NULL || text == NULL){
+        return NULL;
+    }
+    if (g->text_len > 0){
+        memcpy(text, g->text, g->text_len);
+    }
+
+    size_t next = 0;
+    for (int i = 0; i < argc; i++){
+        size_t count = first[i + 1] - first[i];
+        if (count == 0){
+            words[next++] = cmd->cmd[i];
+            continue;
+        }
+        for (size_t m = first[i]; m < first[i + 1]; m++){
+            words[next++] = text + g->matches[m];
+        }
+        qsort(words + next - count, count, sizeof(char*), compare_strings);
+    }
+    words[next] = NULL;
+
+    *expanded = *cmd;
+    expanded->cmd = words;
+    return expanded;
+}
+
+
+/**
+ * Adds the matches of one word to `g`.
+ * @return  false if memory is lacking.
+ * */
+bool glob_word (Glob* g, const char* word){
+    size_t len = strlen(word);
+    if (!grow_array((void**) &g->pattern, &g->pattern_capacity,
+                    2 * len + 1, 1)
+            || !grow_array((void**) &g->parts, &g->parts_capacity,
+                           len / 2 + 2, sizeof(char*))){
+        return false;
+    }
+
+    /* In `fnmatch()` a '\' escapes anything: the plain ones are doubled. */
+    char* to = g->pattern;
+    for (const char* c = word; *c != 0; c++){
+        if (*c == GLOB_ESCAPE && !is_escape(c)){
+            *to++ = GLOB_ESCAPE;
+        }
+        *to++ = *c;
+    }
+    *to = 0;
+
+    /* Splitting at every '/'; an empty component (a '//') is dropped. */
+    g->part_count = 0;
+    g->dir_only = len > 1 && word[len - 1] == '/';
+    char* start = g->pattern;
+    for (char* c = g->pattern; ; c++){
+        if (*c != '/' && *c != 0){
+            continue;
+        }
+        bool end = *c == 0;
+        *c = 0;
+        if (*start != 0){
+            g->parts[g->part_count++] = start;
+        }
+        if (end) break;
+        start = c + 1;
+    }
+
+    g->path_len = 0;
+    if (!glob_push(g, "/", word[0] == '/')){
+        return false;
+    }
+    if (g->part_count > 0){
+        glob_walk(g, 0);
+    }
+    return !g->failed;
+}
+
+
+/**
+ * Adds `word`, without the '\' that escape its special characters, to the
+ * matches of `g`: what a word stands for when it has no pattern to expand.
+ * @return  false if memory is lacking.
+ * */
+bool glob_literal_word (Glob* g, const char* word){
+    g->path_len = 0;
+    if (!glob_push(g, word, strlen(word))){
+        return false;
+    }
+    char* to = g->path;
+    for (const char* c = g->path; *c != 0; c++){
+        if (!is_escape(c)){
+            *to++ = *c;
+        }
+    }
+    *to = 0;
+    g->path_len = 0;  // the word is the name, with no directory before
+    glob_emit(g, g->path, false);
+    return !g->failed;
+}
+
+
+/**
+ * Matches the component `part` of the pattern in the directory `g->path`
+ * (which ends with a '/', or is empty for the current directory), and
+ * goes on with the next component in every directory that matched.
+ * */
+void glob_walk (Glob* g, size_t part){
+    const char* pattern = g->parts[part];
+    bool        last = part + 1 == g->part_count;
+    size_t      base = g->path_len;
+
+    if (strcmp(pattern, GLOB_STAR) == 0){
+        glob_star(g, part);
+        return;
+    }
+
+    /* A plain name needs no listing, only a check at the end. */
+    if (is_literal_part(pattern)){
+        if (!glob_push_literal(g, pattern)){
+            return;
+        }
+        if (!last){
+            if (glob_push(g, "/", 1)) glob_walk(g, part + 1);
+        } else {
+            struct stat st;
+            if (fstatat(AT_FDCWD, g->path, &st, g->dir_only
+                                                ? 0 : AT_SYMLINK_NOFOLLOW) == 0
+                    && (!g->dir_only || S_ISDIR(st.st_mode))){
+                glob_emit(g, "", g->dir_only);
+            }
+        }
+        g->path_len = base;
+        g->path[base] = 0;
+        return;
+    }
+
+    Glob_dir* dir = glob_list(g);
+    if (dir == NULL){
+        return;
+    }
+    for (size_t i = 0; i < dir->count && !g->failed; i++){
+        if (fnmatch(pattern, dir->names[i], FNM_PERIOD) != 0){
+            continue;
+        }
+        if (last && !g->dir_only){
+            glob_emit(g, dir->names[i], false);
+            continue;
+        }
+        if (!glob_is_dir(g, dir, i, true)){
+            continue;
+        }
+        if (last){
+            glob_emit(g, dir->names[i], true);
+            continue;
+        }
+        if (glob_push(g, dir->names[i], strlen(dir->names[i]))
+                && glob_push(g, "/", 1)){
+            glob_walk(g, part + 1);
+        }
+        g->path_len = base;
+        g->path[base] = 0;
+    }
+}
+
+
+/**
+ * Matches "**": no directory at all, then every directory below
+ * `g->path`, each one read once. When it is the last component, every
+ * path below is a match.
+ * */
+void glob_star (Glob* g, size_t part){
+    bool   last = part + 1 == g->part_count;
+    size_t base = g->path_len;
+
+    if (!last){
+        glob_walk(g, part + 1);
+    }
+
+    Glob_dir* dir = glob_list(g);
+    if (dir == NULL){
+        return;
+    }
+    for (size_t i = 0; i < dir->count && !g->failed; i++){
+        if (dir->names[i][0] == '.'){
+            continue;
+        }
+        bool is_dir = glob_is_dir(g, dir, i, false);
+        if (last && (is_dir || !g->dir_only)){
+            glob_emit(g, dir->names[i], is_dir && g->dir_only);
+        }
+        if (!is_dir){
+            continue;
+        }
+        if (glob_push(g, dir->names[i], strlen(dir->names[i]))
+                && glob_push(g, "/", 1)){
+            glob_star(g, part);
+        }
+        g->path_len = base;
+        g->path[base] = 0;
+    }
+}
+
+
+/**
+ * Adds `g->path` followed by `name` (and a '/' if `slash`) to the matches.
+ * */
+void glob_emit (Glob* g, const char* name, bool slash){
+    size_t name_len = strlen(name);
+    size_t len = g->path_len + name_len + slash;
+    if (!grow_array((void**) &g->text, &g->text_capacity,
+                    g->text_len + len + 1, 1)
+            || !grow_array((void**) &g->matches, &g->match_capacity,
+                           g->match_count + 1, sizeof(size_t))){
+        g->failed = true;
+        return;
+    }
+    char* match = g->text + g->text_len;
+    memcpy(match, g->path, g->path_len);
+    memcpy(match + g->path_len, name, name_len);
+    if (slash && (len < 2 || match[len - 2] != '/')){
+        match[len - 1] = '/';
+    } else if (slash){
+        len--;  // `g->path` already ends with it
+    }
+    match[len] = 0;
+    g->matches[g->match_count++] = g->text_len;
+    g->text_len += len + 1;
+}
+
+
+/**
+ * Tells if the entry `i` of `dir` is a directory, from its d_type when
+ * the file system gives one. Only the others cost a `stat()`.
+ * @param   follow  whether a symbolic link to a directory counts.
+ * */
+bool glob_is_dir (Glob* g, const Glob_dir* dir, size_t i, bool follow){
+    unsigned char type = dir->types[i];
+    if (type == DT_DIR){
+        return true;
+    }
+    if (type != DT_UNKNOWN && (type != DT_LNK || !follow)){
+        return false;
+    }
+
+    size_t base = g->path_len;
+    bool   is_dir = false;
+    struct stat st;
+    if (glob_push(g, dir->names[i], strlen(dir->names[i]))
+            && fstatat(AT_FDCWD, g->path, &st,
+                       follow ? 0 : AT_SYMLINK_NOFOLLOW) == 0){
+        is_dir = S_ISDIR(st.st_mode);
+    }
+    g->path_len = base;
+    g->path[base] = 0;
+    return is_dir;
+}
+
+
+/**
+ * Appends `len` characters of `str` to `g->path`, which stays
+ * '\0'-terminated.
+ * @return  false if memory is lacking.
+ * */
+bool glob_push (Glob* g, const char* str, size_t len){
+    if (!grow_array((void**) &g->path, &g->path_capacity,
+                    g->path_len + len + 1, 1)){
+        g->failed = true;
+        return false;
+    }
+    memcpy(g->path + g->path_len, str, len);
+    g->path_len += len;
+    g->path[g->path_len] = 0;
+    return true;
+}
+
+
+/**
+ * Appends the name a component without special characters stands for:
+ * `part` without the '\' that `fnmatch()` would take as escapes.
+ * @return  false if memory is lacking.
+ * */
+bool glob_push_literal (Glob* g, const char* part){
+    size_t len = strlen(part);
+    if (!glob_push(g, part, len)){
+        return false;
+    }
+    char* to = g->path + g->path_len - len;
+    for (const char* c = part; *c != 0; c++){
+        if (*c == GLOB_ESCAPE && c[1] != 0){
+            c++;
+        }
+        *to++ = *c;
+    }
+    g->path_len = to - g->path;
+    *to = 0;
+    return true;
+}
+
+
+
+
+/* ********************************************************
+ * DIRECTORY CACHE
+ * ****************************************************** */
+
+
+/**
+ * Gives the entries of the directory `g->path`, read only the first time
+ * the command asks for it.
+ * @return  the listing, or NULL if memory is lacking.
+ * */
+Glob_dir* glob_list (Glob* g){
+    uint64_t hash = FNV_OFFSET;
+    for (size_t i = 0; i < g->path_len; i++){
+        hash = (hash ^ (unsigned char) g->path[i]) * FNV_PRIME;
+    }
+    Glob_dir** bucket = &g->buckets[hash % GLOB_CACHE_BUCKETS];
+    for (Glob_dir* dir = *bucket; dir != NULL; dir = dir->next){
+        if (dir->hash == hash && strcmp(dir->path, g->path) == 0){
+            return dir;
+        }
+    }
+
+    Glob_dir* dir = arena_alloc(&LINE_ARENA, sizeof(Glob_dir));
+    char*     path = arena_strdup(&LINE_ARENA, g->path);
+    if (dir == NULL || path == NULL){
+        g->failed = true;
+        return NULL;
+    }
+    memset(dir, 0, sizeof(*dir));
+    dir->hash = hash;
+    dir->path = path;
+
+    int fd = open(g->path_len > 0 ? g->path : ".",
+                  O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd >= 0){
+        bool read = glob_read_dir(g, fd, dir);
+        close(fd);
+        if (!read){
+            g->failed = true;
+            return NULL;
+        }
+    }
+
+    dir->next = *bucket;
+    *bucket = dir;
+    g->cached = true;
+    return dir;
+}
+
+
+/**
+ * Reads a whole directory with `getdents64()`, GLOB_READ_SIZE bytes at a
+ * time. The names of each batch are copied at once into the arena.
+ * @return  false if memory is lacking.
+ * */
+bool glob_read_dir (Glob* g, int fd, Glob_dir* dir){
+    if (g->dirents == NULL && (g->dirents = malloc(GLOB_READ_SIZE)) == NULL){
+        return false;
+    }
+
+    size_t count = 0;
+    long   got;
+    while ((got = syscall(SYS_getdents64, fd, g->dirents,
+                          GLOB_READ_SIZE)) > 0){
+        size_t bytes = 0;
+        size_t entries = 0;
+        for (long at = 0; at < got; ){
+            Glob_dirent* entry = (Glob_dirent*) (g->dirents + at);
+            at += entry->reclen;
+            const char* name = entry->name;
+            if (name[0] == '.' && (name[1] == 0
+                                   || (name[1] == '.' && name[2] == 0))){
+                continue;
+            }
+            bytes += strlen(name) + 1;
+            entries++;
+        }
+
+        char* names = arena_alloc(&LINE_ARENA, bytes);
+        if ((bytes > 0 && names == NULL)
+                || !grow_array((void**) &g->names, &g->names_capacity,
+                               count + entries, sizeof(char*))
+                || (g->types = realloc(g->types, g->names_capacity)) == NULL){
+            return false;
+        }
+        for (long at = 0; at < got; ){
+            Glob_dirent* entry = (Glob_dirent*) (g->dirents + at);
+            at += entry->reclen;
+            const char* name = entry->name;
+            if (name[0] == '.' && (name[1] == 0
+                                   || (name[1] == '.' && name[2] == 0))){
+                continue;
+            }
+            size_t len = strlen(name) + 1;
+            memcpy(names, name, len);
+            g->names[count] = names;
+            g->types[count++] = entry->type;
+            names += len;
+        }
+    }
+
+    dir->names = arena_alloc(&LINE_ARENA, count * sizeof(char*) + 1);
+    dir->types = arena_alloc(&LINE_ARENA, count + 1);
+    if (dir->names == NULL || dir->types == NULL){
+        return false;
+    }
+    memcpy(dir->names, g->names, count * sizeof(char*));
+    memcpy(dir->types, g->types, count);
+    dir->count = count;
+    return true;
+}
+
+
+/**
+ * Empties the cache of the directories: another command may have changed
+ * them, and the listings go with the LINE_ARENA anyway.
+ * */
+void glob_forget (Glob* g){
+    if (g->cached){
+        memset(g->buckets, 0, sizeof(g->buckets));
+        g->cached = false;
+    }
+}
+
+
+/**
+ * Gives the buffers back to the system.
+ * */
+void glob_free (Glob* g){
+    free(g->dirents);
+    free(g->names);
+    free(g->types);
+    free(g->pattern);
+    free(g->parts);
+    free(g->path);
+    free(g->text);
+    free(g->matches);
+    memset(g, 0, sizeof(*g));
+}
+
+
+
+
+/* ********************************************************
+ * UTILS
+ * ****************************************************** */
+
+
+/**
+ * @return  true if `word` has a '*', '?' or '[' that no '\' escapes.
+ * */
+bool has_glob (const char* word){
+    for (const char* c = word; *c != 0; c++){
+        if (is_escape(c)){
+            c++;
+        } else if (strchr(GLOB_CHARS, *c) != NULL){
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * @return  true if `word` has a '\' to remove (see `is_escape()`).
+ * */
+bool has_escape (const char* word){
+    for (const char* c = strchr(word, GLOB_ESCAPE); c != NULL;
+         c = strchr(c + 1, GLOB_ESCAPE)){
+        if (is_escape(c)){
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * @return  true if `c` is a '\' followed by '*', '?' or '['. Any other
+ *          '\' is an ordinary character, as it was before escapes.
+ * */
+bool is_escape (const char* c){
+    return c[0] == GLOB_ESCAPE && c[1] != 0 && strchr(GLOB_CHARS, c[1]) != NULL;
+}
+
+
+/**
+ * @return  true if the component `part` of a pattern, in `fnmatch()`
+ *          syntax, has no special character that is not escaped.
+ * */
+bool is_literal_part (const char* part){
+    for (const char* c = part; *c != 0; c++){
+        if (*c == GLOB_ESCAPE && c[1] != 0){
+            c++;
+        } else if (strchr(GLOB_CHARS, *c) != NULL){
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/**
+ * Makes room for `needed` items of `item` bytes in `*array`, doubling it.
+ * @return  false if memory is lacking (`*array` is then unchanged).
+ * */
+bool grow_array (void** array, size_t* capacity, size_t needed, size_t item){
+    if (needed <= *capacity){
+        return true;
+    }
+    size_t new_capacity = *capacity ? *capacity : GLOB_MIN_CAPACITY;
+    while (new_capacity < needed) new_capacity *= 2;
+    void* grown = realloc(*array, new_capacity * item);
+    if (grown == NULL){
+        return false;
+    }
+    *array = grown;
+    *capacity = new_capacity;
+    return true;
+}
+
+
+int compare_strings (const void* a, const void* b){
+    return strcmp(*(char* const*) a, *(char* const*) b);
+}
+
+
+#endif //TESTSHELL_GLOB_H
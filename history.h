@@ -0,0 +1,681 @@
+#ifndef TESTSHELL_HISTORY_H
+#define TESTSHELL_HISTORY_H
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <sys/uio.h>
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define HISTORY_BUILTIN "history"
+#define HISTORY_USAGE "usage: history [COUNT]\n"
+#define HISTORY_ENV_VAR "SHELL_HISTORY"
+#define HISTORY_DEFAULT_FILE ".shell_fork_history"  // in $HOME
+#define HISTORY_INDEX_SUFFIX ".idx"
+#define HISTORY_RECALL '!'
+
+#define HISTORY_MAP_MIN (1024 * 1024)   // the mappings grow by doubling
+#define HISTORY_BATCH 512               // offsets written at once
+#define HISTORY_NOT_FOUND SIZE_MAX
+
+#define GRAM_N 3                        // the index is made of trigrams
+#define GRAM_LINE_START 0               // byte before every entry, so a
+                                        // prefix is a substring like another
+#define GRAM_TABLE_MIN 4096
+#define GRAM_CHECKED_MAX 5              // postings tested for a candidate
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * A file mapped in memory, read-only. The mapping is bigger than the file,
+ * so what the shell appends with `write()` shows up in it at no cost: it
+ * is only mapped again when the file outgrows it.
+ * */
+typedef struct Mapped_file {
+    int             fd;
+    char*           data;
+    size_t          size;           // bytes of the file known so far
+    size_t          mapped;
+} Mapped_file;
+
+
+/**
+ * Entries of the history that contain an n-gram, oldest first.
+ * */
+typedef struct Posting {
+    uint32_t        gram;           // 0 for a free slot
+    uint32_t        count;
+    uint32_t        capacity;
+    uint32_t*       ids;
+} Posting;
+
+
+/**
+ * Trigram index of the entries, for the searches. It is only built by the
+ * first search, then kept up to date as lines are added.
+ * */
+typedef struct Gram_index {
+    Posting*        slots;          // open addressing, linear probing
+    size_t          capacity;       // power of two, or 0
+    size_t          used;
+    size_t          indexed;        // entries [0, indexed) are in it
+    bool            built;
+} Gram_index;
+
+
+/**
+ * The history is an append-only log of the lines, each ended by a '\n',
+ * and an index file with the offset of the end of every line (8 bytes
+ * each). Both are mapped, so opening costs the same whatever their size,
+ * and the n-th entry is found without reading the log.
+ *
+ * Every shell appends to them under a `flock()`: the lines of several
+ * shells are interleaved, never mixed. Lines a crash left out of the index
+ * are indexed again when the history is opened.
+ * */
+typedef struct History {
+    Mapped_file     log;
+    Mapped_file     index;
+    size_t          count;          // entries in the index file
+    Gram_index      grams;
+    bool            open;
+} History;
+
+
+History HISTORY = {{-1, NULL, 0, 0}, {-1, NULL, 0, 0}, 0,
+                   {NULL, 0, 0, 0, false}, false};
+const char* HISTORY_FILE = NULL;    // NULL: the default, "": no history
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+bool        history_open        (History* h, const char* path);
+void        history_close       (History* h);
+bool        history_add         (History* h, const char* line, size_t len);
+bool        history_catch_up    (History* h);
+const char* history_entry       (const History* h, size_t i, size_t* len);
+size_t      history_search      (History* h, const char* text, size_t len,
+                                 bool prefix, size_t before);
+size_t      history_scan        (const History* h, const char* text,
+                                 size_t len, bool prefix, size_t before);
+bool        history_matches     (const History* h, size_t i,
+                                 const char* text, size_t len, bool prefix);
+char*       history_expand      (History* h, char* line, size_t* len);
+char*       history_default_path();
+bool        history_start       (History* h, const char* path);
+int         history_builtin     (Command* cmd);
+
+bool        map_file            (Mapped_file* file, size_t size);
+void        unmap_file          (Mapped_file* file);
+
+bool        gram_index_update   (Gram_index* index, const History* h);
+bool        gram_index_add      (Gram_index* index, uint32_t gram,
+                                 uint32_t id);
+Posting*    gram_find           (const Gram_index* index, uint32_t gram);
+bool        gram_grow           (Gram_index* index);
+uint32_t    gram_at             (const char* text, bool prefix, size_t i);
+size_t      gram_slot           (uint32_t gram, size_t capacity);
+bool        posting_has         (const Posting* posting, uint32_t id);
+void        gram_index_free     (Gram_index* index);
+
+
+
+
+/* ********************************************************
+ * FILE FUNCTIONS
+ * ****************************************************** */
+
+
+/**
+ * Makes sure the first `size` bytes of the file are mapped.
+ * */
+bool map_file (Mapped_file* file, size_t size){
+    file->size = size;
+    if (size <= file->mapped && file->data != NULL){
+        return true;
+    }
+
+    size_t page = (size_t) sysconf(_SC_PAGESIZE);
+    size_t length = size * 2 > HISTORY_MAP_MIN ? size * 2 : HISTORY_MAP_MIN;
+    length = (length + page - 1) / page * page;
+
+    unmap_file(file);
+    void* data = mmap(NULL, length, PROT_READ, MAP_SHARED, file->fd, 0);
+    if (data == MAP_FAILED){
+        return false;
+    }
+    file->data = data;
+    file->mapped = length;
+    return true;
+}
+
+
+void unmap_file (Mapped_file* file){
+    if (file->data != NULL){
+        munmap(file->data, file->mapped);
+    }
+    file->data = NULL;
+    file->mapped = 0;
+}
+
+
+/**
+ * @return  "$HOME/.shell_fork_history" (malloc'd), or NULL without $HOME.
+ * */
+char* history_default_path (){
+    const char* home = getenv("HOME");
+    if (home == NULL || *home == 0){
+        return NULL;
+    }
+    char* path = malloc(strlen(home) + sizeof(HISTORY_DEFAULT_FILE) + 1);
+    if (path != NULL){
+        sprintf(path, "%s/%s", home, HISTORY_DEFAULT_FILE);
+    }
+    return path;
+}
+
+
+/**
+ * Opens the history of the user.
+ * @param   path    NULL for the default file, "" for no history at all.
+ * @return  false if the history is not usable; errno tells why.
+ * */
+bool history_start (History* h, const char* path){
+    if (path != NULL){
+        return *path == 0 || history_open(h, path);
+    }
+    char* default_path = history_default_path();
+    if (default_path == NULL){
+        return true;  // nowhere to keep it
+    }
+    bool ok = history_open(h, default_path);
+    free(default_path);
+    return ok;
+}
+
+
+/**
+ * Opens (or creates) the log at `path` and its index at `path`.idx.
+ * @return  false if the history is not usable; errno tells why.
+ * */
+bool history_open (History* h, const char* path){
+    char* index_path = malloc(strlen(path) + sizeof(HISTORY_INDEX_SUFFIX));
+    if (index_path == NULL){
+        return false;
+    }
+    sprintf(index_path, "%s%s", path, HISTORY_INDEX_SUFFIX);
+
+    int flags = O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC;
+    h->log.fd = open(path, flags, 0600);
+    h->index.fd = open(index_path, flags, 0600);
+    free(index_path);
+
+    if (h->log.fd < 0 || h->index.fd < 0){
+        history_close(h);
+        return false;
+    }
+
+    flock(h->log.fd, LOCK_EX);
+    bool ok = history_catch_up(h);
+    flock(h->log.fd, LOCK_UN);
+    if (!ok){
+        history_close(h);
+        return false;
+    }
+    h->open = true;
+    return true;
+}
+
+
+void history_close (History* h){
+    unmap_file(&h->log);
+    unmap_file(&h->index);
+    if (h->log.fd >= 0) close(h->log.fd);
+    if (h->index.fd >= 0) close(h->index.fd);
+    h->log.fd = -1;
+    h->index.fd = -1;
+    h->count = 0;
+    gram_index_free(&h->grams);
+    h->open = false;
+}
+
+
+/**
+ * Maps what the files hold now, with the lines of the other shells. The
+ * lines of the log that are not in the index (a shell died between both
+ * writes) are added to it; an index that goes beyond the log is rebuilt.
+ * Must be called with the lock held.
+ * */
+bool history_catch_up (History* h){
+    struct stat log_stat, index_stat;
+    if (fstat(h->log.fd, &log_stat) < 0 || fstat(h->index.fd, &index_stat) < 0){
+        return false;
+    }
+
+    size_t count = (size_t) index_stat.st_size / sizeof(uint64_t);
+    if (!map_file(&h->index, count * sizeof(uint64_t))
+            || !map_file(&h->log, (size_t) log_stat.st_size)){
+        return false;
+    }
+
+    const uint64_t* ends = (const uint64_t*) h->index.data;
+    uint64_t indexed = count > 0 ? ends[count - 1] + 1 : 0;
+    if (indexed > h->log.size || index_stat.st_size % sizeof(uint64_t) != 0){
+        if (ftruncate(h->index.fd, 0) < 0){
+            return false;
+        }
+        count = 0;
+        indexed = 0;
+        gram_index_free(&h->grams);
+    }
+
+    uint64_t batch[HISTORY_BATCH];
+    size_t   batched = 0;
+    for (size_t at = indexed; at <= h->log.size; at++){
+        bool flush = batched == HISTORY_BATCH || at == h->log.size;
+        if (flush && batched > 0){
+            size_t bytes = batched * sizeof(uint64_t);
+            if (write(h->index.fd, batch, bytes) != (ssize_t) bytes){
+                return false;
+            }
+            count += batched;
+            batched = 0;
+        }
+        if (at < h->log.size && h->log.data[at] == '\n'){
+            batch[batched++] = at;
+        }
+    }
+
+    h->count = count;
+    return map_file(&h->index, count * sizeof(uint64_t));
+}
+
+
+/**
+ * @return  the text of the i-th entry (the oldest is 0), which is not
+ *          '\0'-terminated.
+ * */
+const char* history_entry (const History* h, size_t i, size_t* len){
+    const uint64_t* ends = (const uint64_t*) h->index.data;
+    size_t start = i > 0 ? ends[i - 1] + 1 : 0;
+    *len = ends[i] - start;
+    return h->log.data + start;
+}
+
+
+/**
+ * Appends a line typed by the user, unless it is the same as the last one.
+ * */
+bool history_add (History* h, const char* line, size_t len){
+    size_t first = 0;
+    while (first < len && line[first] == ' ') first++;
+    if (!h->open || first == len){
+        return false;  // blank
+    }
+
+    size_t last_len;
+    if (h->count > 0){
+        const char* last = history_entry(h, h->count - 1, &last_len);
+        if (last_len == len && memcmp(last, line, len) == 0){
+            return false;
+        }
+    }
+
+    flock(h->log.fd, LOCK_EX);
+    bool ok = history_catch_up(h);
+    const uint64_t* ends = (const uint64_t*) h->index.data;
+    if (ok && h->log.size != (h->count > 0 ? ends[h->count - 1] + 1 : 0)){
+        // the end of a line a crash cut off: it is an entry of its own
+        ok = write(h->log.fd, "\n", 1) == 1 && history_catch_up(h);
+    }
+
+    uint64_t end = h->log.size + len;
+    struct iovec parts[2] = {{(void*) line, len}, {"\n", 1}};
+    ok = ok && writev(h->log.fd, parts, 2) == (ssize_t) len + 1
+            && write(h->index.fd, &end, sizeof(end)) == sizeof(end)
+            && history_catch_up(h);
+    flock(h->log.fd, LOCK_UN);
+
+    return ok && (!h->grams.built || gram_index_update(&h->grams, h));
+}
+
+
+
+
+/* ********************************************************
+ * SEARCH FUNCTIONS
+ * ****************************************************** */
+
+
+/**
+ * Finds the most recent entry older than `before` that contains `text`
+ * (or starts with it, for a `prefix` search).
+ *
+ * The entries are only compared with the text when they contain all its
+ * trigrams: the rarest one gives the candidates, newest first, and a few
+ * others are looked up in their postings by binary search.
+ * @return  the index of the entry, or HISTORY_NOT_FOUND.
+ * */
+size_t history_search (History* h, const char* text, size_t len,
+                       bool prefix, size_t before){
+    if (before > h->count) before = h->count;
+    size_t grams = len + prefix >= GRAM_N ? len + prefix - GRAM_N + 1 : 0;
+    if (grams == 0 || !gram_index_update(&h->grams, h)){
+        return history_scan(h, text, len, prefix, before);
+    }
+
+    const Posting* checked[GRAM_CHECKED_MAX];  // the rarest first
+    size_t         checked_count = 0;
+    for (size_t g = 0; g < grams; g++){
+        const Posting* posting = gram_find(&h->grams,
+                                           gram_at(text, prefix, g));
+        if (posting == NULL){
+            return HISTORY_NOT_FOUND;  // no entry has this trigram
+        }
+        if (checked_count == GRAM_CHECKED_MAX
+                && posting->count >= checked[checked_count - 1]->count){
+            continue;
+        }
+        size_t at = checked_count < GRAM_CHECKED_MAX ? checked_count++
+                                                     : checked_count - 1;
+        while (at > 0 && checked[at - 1]->count > posting->count){
+            checked[at] = checked[at - 1];
+            at--;
+        }
+        checked[at] = posting;
+    }
+
+    const Posting* rarest = checked[0];
+    size_t low = 0, high = rarest->count;   // first id >= before
+    while (low < high){
+        size_t mid = (low + high) / 2;
+        if (rarest->ids[mid] < before) low = mid + 1;
+        else high = mid;
+    }
+
+    for (size_t c = low; c-- > 0;){
+        uint32_t id = rarest->ids[c];
+        bool candidate = true;
+        for (size_t p = 1; p < checked_count && candidate; p++){
+            candidate = posting_has(checked[p], id);
+        }
+        if (candidate && history_matches(h, id, text, len, prefix)){
+            return id;
+        }
+    }
+    return HISTORY_NOT_FOUND;
+}
+
+
+/**
+ * Search without the index, for the texts shorter than a trigram: they
+ * are found in the last few entries anyway.
+ * */
+size_t history_scan (const History* h, const char* text, size_t len,
+                     bool prefix, size_t before){
+    for (size_t i = before; i-- > 0;){
+        if (history_matches(h, i, text, len, prefix)){
+            return i;
+        }
+    }
+    return HISTORY_NOT_FOUND;
+}
+
+
+bool history_matches (const History* h, size_t i,
+                      const char* text, size_t len, bool prefix){
+    size_t      entry_len;
+    const char* entry = history_entry(h, i, &entry_len);
+    if (prefix){
+        return entry_len >= len && memcmp(entry, text, len) == 0;
+    }
+    return memmem(entry, entry_len, text, len) != NULL;
+}
+
+
+/**
+ * Replaces a line starting with `!` by the entry it recalls: `!!` is the
+ * last one, `!prefix` the last one that starts with `prefix`. The words
+ * after the first are appended to it, and the new line is echoed.
+ * @return  the new line (in the LINE_ARENA), `line` itself if it recalls
+ *          nothing, or NULL if no entry matches.
+ * */
+char* history_expand (History* h, char* line, size_t* len){
+    char* word = line;
+    while (*word == ' ') word++;
+    if (*word != HISTORY_RECALL || word[1] == 0 || word[1] == ' '){
+        return line;
+    }
+
+    char*  prefix = word + 1;
+    char*  rest = strchr(prefix, ' ');
+    size_t prefix_len = rest != NULL ? (size_t) (rest - prefix)
+                                     : strlen(prefix);
+    if (rest == NULL) rest = prefix + prefix_len;
+
+    size_t found = HISTORY_NOT_FOUND;
+    if (h->open && prefix_len == 1 && *prefix == HISTORY_RECALL){
+        found = h->count > 0 ? h->count - 1 : HISTORY_NOT_FOUND;
+    } else if (h->open){
+        found = history_search(h, prefix, prefix_len, true, h->count);
+    }
+    if (found == HISTORY_NOT_FOUND){
+        fprintf(stderr, "%.*s: event not found\n", (int) prefix_len + 1, word);
+        return NULL;
+    }
+
+    size_t      entry_len;
+    const char* entry = history_entry(h, found, &entry_len);
+    size_t      rest_len = *len - (size_t) (rest - line);
+    char*       expanded = arena_alloc(&LINE_ARENA, entry_len + rest_len + 1);
+    if (expanded == NULL){
+        return NULL;  // OOM
+    }
+    memcpy(expanded, entry, entry_len);
+    memcpy(expanded + entry_len, rest, rest_len + 1);
+    *len = entry_len + rest_len;
+
+    printf("%s\n", expanded);
+    return expanded;
+}
+
+
+/**
+ * `history`        prints every entry, numbered from 1.
+ * `history COUNT`  prints the last COUNT entries.
+ * */
+int history_builtin (Command* cmd){
+    size_t count = HISTORY.count;
+    if (cmd->cmd[1] != NULL){
+        char* end;
+        unsigned long value = strtoul(cmd->cmd[1], &end, 10);
+        if (cmd->cmd[2] != NULL || *cmd->cmd[1] < '0' || *cmd->cmd[1] > '9'
+                || *end != 0){
+            fprintf(stderr, HISTORY_USAGE);
+            return false;
+        }
+        if (value < count) count = value;
+    }
+
+    for (size_t i = HISTORY.count - count; i < HISTORY.count; i++){
+        size_t      len;
+        const char* entry = history_entry(&HISTORY, i, &len);
+        printf("%6zu  %.*s\n", i + 1, (int) len, entry);
+    }
+    return true;
+}
+
+
+
+
+/* ********************************************************
+ * N-GRAM INDEX
+ * ****************************************************** */
+
+
+/**
+ * The i-th trigram of `text`, preceded by GRAM_LINE_START for a prefix.
+ * It is never 0, the key of the free slots.
+ * */
+uint32_t gram_at (const char* text, bool prefix, size_t i){
+    uint32_t gram = 1;
+    for (size_t k = i; k < i + GRAM_N; k++){
+        unsigned char c = prefix ? (k == 0 ? GRAM_LINE_START : text[k - 1])
+                                 : text[k];
+        gram = (gram << 8) | c;
+    }
+    return gram;
+}
+
+
+/**
+ * Fibonacci hashing: the top bits of the product depend on every byte of
+ * the trigram, the bottom ones only on the last.
+ * */
+size_t gram_slot (uint32_t gram, size_t capacity){
+    return (uint32_t) (gram * 2654435761u) >> (32 - __builtin_ctzll(capacity));
+}
+
+
+/**
+ * Adds the entries that are not in the index yet: all of them on the first
+ * search, the new lines after that.
+ * */
+bool gram_index_update (Gram_index* index, const History* h){
+    index->built = true;
+    for (; index->indexed < h->count; index->indexed++){
+        size_t      len;
+        const char* entry = history_entry(h, index->indexed, &len);
+        for (size_t g = 0; g + GRAM_N <= len + 1; g++){
+            if (!gram_index_add(index, gram_at(entry, true, g),
+                                (uint32_t) index->indexed)){
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+bool gram_index_add (Gram_index* index, uint32_t gram, uint32_t id){
+    if ((index->used + 1) * 4 > index->capacity * 3 && !gram_grow(index)){
+        return false;
+    }
+
+    size_t mask = index->capacity - 1;
+    size_t slot = gram_slot(gram, index->capacity);
+    while (index->slots[slot].gram != 0 && index->slots[slot].gram != gram){
+        slot = (slot + 1) & mask;
+    }
+
+    Posting* posting = &index->slots[slot];
+    if (posting->gram == 0){
+        posting->gram = gram;
+        index->used++;
+    }
+    if (posting->count > 0 && posting->ids[posting->count - 1] == id){
+        return true;  // the same trigram twice in an entry
+    }
+    if (posting->count == posting->capacity){
+        uint32_t capacity = posting->capacity ? posting->capacity * 2 : 4;
+        uint32_t* ids = realloc(posting->ids, capacity * sizeof(uint32_t));
+        if (ids == NULL){
+            return false;
+        }
+        posting->ids = ids;
+        posting->capacity = capacity;
+    }
+    posting->ids[posting->count++] = id;
+    return true;
+}
+
+
+Posting* gram_find (const Gram_index* index, uint32_t gram){
+    if (index->capacity == 0){
+        return NULL;
+    }
+    size_t mask = index->capacity - 1;
+    size_t slot = gram_slot(gram, index->capacity);
+    while (index->slots[slot].gram != 0){
+        if (index->slots[slot].gram == gram){
+            return &index->slots[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+    return NULL;
+}
+
+
+bool gram_grow (Gram_index* index){
+    size_t capacity = index->capacity ? index->capacity * 2 : GRAM_TABLE_MIN;
+    Posting* slots = calloc(capacity, sizeof(Posting));
+    if (slots == NULL){
+        return false;
+    }
+
+    for (size_t i = 0; i < index->capacity; i++){
+        Posting* posting = &index->slots[i];
+        if (posting->gram == 0){
+            continue;
+        }
+        size_t slot = gram_slot(posting->gram, capacity);
+        while (slots[slot].gram != 0){
+            slot = (slot + 1) & (capacity - 1);
+        }
+        slots[slot] = *posting;
+    }
+    free(index->slots);
+    index->slots = slots;
+    index->capacity = capacity;
+    return true;
+}
+
+
+bool posting_has (const Posting* posting, uint32_t id){
+    size_t low = 0, high = posting->count;
+    while (low < high){
+        size_t mid = (low + high) / 2;
+        if (posting->ids[mid] < id) low = mid + 1;
+        else if (posting->ids[mid] > id) high = mid;
+        else return true;
+    }
+    return false;
+}
+
+
+void gram_index_free (Gram_index* index){
+    for (size_t i = 0; i < index->capacity; i++){
+        free(index->slots[i].ids);
+    }
+    free(index->slots);
+    *index = (Gram_index) {NULL, 0, 0, 0, false};
+}
+
+
+#endif //TESTSHELL_HISTORY_H
@@ -0,0 +1,160 @@
+#ifndef TESTSHELL_JOB_USAGE_H
+#define TESTSHELL_JOB_USAGE_H
+
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * Resources used by the foreground children waited for since the
+ * innermost `time` started. Every `wait4()` of the shell adds to it.
+ * */
+struct rusage CHILD_USAGE;
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * What a `time` being evaluated has to remember until its child is done.
+ * They nest: an outer `time` gets the usage of the inner ones back.
+ * */
+typedef struct Time_frame {
+    struct rusage       outer;          // CHILD_USAGE of the enclosing time
+    struct rusage       self_before;
+    struct timespec     start;
+} Time_frame;
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+void   add_usage          (struct rusage* total, const struct rusage* more);
+void   print_usage        (double real, const struct rusage* usage);
+double seconds_between    (const struct timespec* start,
+                           const struct timespec* end);
+double tv_seconds         (const struct timeval* tv);
+void   time_start         (Time_frame* frame);
+void   time_stop          (Time_frame* frame);
+
+
+
+
+/* ********************************************************
+ * USAGE FUNCTIONS
+ * ****************************************************** */
+
+
+/**
+ * Adds the times and context switches of `more` to `total`. The maximum
+ * resident set size is the largest of both.
+ * */
+void add_usage (struct rusage* total, const struct rusage* more){
+    total->ru_utime.tv_sec  += more->ru_utime.tv_sec;
+    total->ru_utime.tv_usec += more->ru_utime.tv_usec;
+    total->ru_stime.tv_sec  += more->ru_stime.tv_sec;
+    total->ru_stime.tv_usec += more->ru_stime.tv_usec;
+    if (total->ru_utime.tv_usec >= 1000000){
+        total->ru_utime.tv_sec++;
+        total->ru_utime.tv_usec -= 1000000;
+    }
+    if (total->ru_stime.tv_usec >= 1000000){
+        total->ru_stime.tv_sec++;
+        total->ru_stime.tv_usec -= 1000000;
+    }
+    if (more->ru_maxrss > total->ru_maxrss){
+        total->ru_maxrss = more->ru_maxrss;
+    }
+    total->ru_nvcsw  += more->ru_nvcsw;
+    total->ru_nivcsw += more->ru_nivcsw;
+}
+
+
+double tv_seconds (const struct timeval* tv){
+    return (double) tv->tv_sec + (double) tv->tv_usec / 1e6;
+}
+
+
+double seconds_between (const struct timespec* start,
+                        const struct timespec* end){
+    return (double) (end->tv_sec - start->tv_sec)
+         + (double) (end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+
+/**
+ * Prints what `time` reports, on stderr like other shells.
+ * */
+void print_usage (double real, const struct rusage* usage){
+    fprintf(stderr, "\nreal\t%.3fs\nuser\t%.3fs\nsys\t%.3fs\n"
+                    "maxrss\t%ld KiB\nctxsw\t%ld voluntary, %ld involuntary\n",
+            real, tv_seconds(&usage->ru_utime), tv_seconds(&usage->ru_stime),
+            usage->ru_maxrss, usage->ru_nvcsw, usage->ru_nivcsw);
+}
+
+
+/**
+ * Starts measuring the child of a TIME_EXPRESSION: the children waited for
+ * from now on are counted in a fresh CHILD_USAGE.
+ * */
+void time_start (Time_frame* frame){
+    frame->outer = CHILD_USAGE;
+    memset(&CHILD_USAGE, 0, sizeof(CHILD_USAGE));
+    getrusage(RUSAGE_SELF, &frame->self_before);
+    clock_gettime(CLOCK_MONOTONIC, &frame->start);
+}
+
+
+/**
+ * Reports the wall-clock time since `time_start()`, with the resources
+ * used by the children it waited for and by the shell itself (for the
+ * builtins). The maximum resident set size is the one of the biggest child.
+ * */
+void time_stop (Time_frame* frame){
+    struct rusage   self_after;
+    struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    getrusage(RUSAGE_SELF, &self_after);
+
+    struct rusage used = CHILD_USAGE;
+    struct rusage self;
+    memset(&self, 0, sizeof(self));
+    timersub(&self_after.ru_utime, &frame->self_before.ru_utime,
+             &self.ru_utime);
+    timersub(&self_after.ru_stime, &frame->self_before.ru_stime,
+             &self.ru_stime);
+    self.ru_nvcsw  = self_after.ru_nvcsw  - frame->self_before.ru_nvcsw;
+    self.ru_nivcsw = self_after.ru_nivcsw - frame->self_before.ru_nivcsw;
+    add_usage(&used, &self);
+
+    fflush(stdout);
+    print_usage(seconds_between(&frame->start, &end), &used);
+
+    add_usage(&frame->outer, &CHILD_USAGE);  // an outer `time` counts them too
+    CHILD_USAGE = frame->outer;
+}
+
+
+#endif //TESTSHELL_JOB_USAGE_H
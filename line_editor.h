@@ -0,0 +1,426 @@
+#ifndef TESTSHELL_LINE_EDITOR_H
+#define TESTSHELL_LINE_EDITOR_H
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <termios.h>        // CTRL()
+
+#include "history.h"
+#include "completion.h"
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define KEY_ESCAPE 27
+#define KEY_BACKSPACE 127
+#define KEY_REDRAW CTRL('L')
+#define SEARCH_QUERY_MAX 256
+#define SEARCH_PROMPT "(reverse-i-search)`%.*s': "
+#define SEARCH_FAILED_PROMPT "(failed reverse-i-search)`%.*s': "
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * The line being typed at the prompt. The terminal is in non-canonical
+ * mode while it is edited, and given back as it was before the line is
+ * run.
+ * */
+typedef struct Line_editor {
+    const char*     prompt;
+    char**          buffer;         // INPUT_LINE
+    size_t*         capacity;
+    size_t          len;
+    size_t          cursor;
+    size_t          browsed;        // entry shown by Up/Down, or the count
+    char*           typed;          // the line before Up was pressed
+    size_t          typed_len;
+    struct termios  terminal;
+} Line_editor;
+
+
+bool LINE_EDITING = false;          // the input and the output are a tty
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+char* edit_line        (const char* prompt, char** buffer, size_t* capacity,
+                        size_t* len);
+int   editor_key       ();
+int   editor_escape    ();
+int   editor_search    (Line_editor* ed);
+bool  editor_set       (Line_editor* ed, const char* text, size_t len);
+bool  editor_insert    (Line_editor* ed, char c);
+void  editor_erase     (Line_editor* ed, size_t from, size_t to);
+void  editor_browse    (Line_editor* ed, size_t entry);
+void  editor_redraw    (const Line_editor* ed);
+void  editor_complete  (Line_editor* ed, bool again);
+
+
+
+
+/* ********************************************************
+ * EDITING FUNCTIONS
+ * ****************************************************** */
+
+
+/**
+ * Reads a line from the terminal with the usual keys: arrows, Home/End and
+ * Ctrl-A/E, Ctrl-B/F, Ctrl-U/K, Backspace/Delete, Up/Down and Ctrl-P/N to
+ * go through the history, Ctrl-R to search it and Tab to complete a word.
+ * Ctrl-C drops the line.
+ * @param   buffer, capacity    where the line goes, grown if needed.
+ * @return  the line (in `*buffer`), or NULL at the end of the input.
+ * */
+char* edit_line (const char* prompt, char** buffer, size_t* capacity,
+                 size_t* len){
+    Line_editor ed = {prompt, buffer, capacity, 0, 0, HISTORY.count,
+                      NULL, 0, {0}};
+    if (tcgetattr(STDIN_FILENO, &ed.terminal) < 0 || !editor_set(&ed, "", 0)){
+        return NULL;
+    }
+    struct termios raw = ed.terminal;
+    raw.c_lflag &= ~(ICANON | ECHO | ISIG);  // ^C and ^Z are keys here
+    raw.c_cc[VMIN] = 1;
+    raw.c_cc[VTIME] = 0;
+    tcsetattr(STDIN_FILENO, TCSADRAIN, &raw);
+
+    int key = 0;
+    int previous;
+    bool done = false;
+    bool eof = false;
+    while (!done){
+        previous = key;
+        key = editor_key();
+        if (key == CTRL('R')){
+            key = editor_search(&ed);
+        }
+
+        switch (key){
+            case -1:            eof = true;     done = true;    break;
+            case '\r':
+            case '\n':                          done = true;    break;
+            case CTRL('C'):
+                printf("^C");
+                ed.len = 0;
+                done = true;
+                break;
+            case CTRL('D'):
+                if (ed.len == 0){
+                    eof = true;
+                    done = true;
+                } else if (ed.cursor < ed.len){
+                    editor_erase(&ed, ed.cursor, ed.cursor + 1);
+                }
+                break;
+            case KEY_BACKSPACE:
+            case CTRL('H'):
+                if (ed.cursor > 0) editor_erase(&ed, ed.cursor - 1, ed.cursor);
+                break;
+            case CTRL('A'):     ed.cursor = 0;                  break;
+            case CTRL('E'):     ed.cursor = ed.len;             break;
+            case CTRL('B'):     if (ed.cursor > 0) ed.cursor--; break;
+            case CTRL('F'):     if (ed.cursor < ed.len) ed.cursor++; break;
+            case CTRL('U'):     editor_erase(&ed, 0, ed.cursor); break;
+            case CTRL('K'):     editor_erase(&ed, ed.cursor, ed.len); break;
+            case KEY_REDRAW:                                    break;
+            case '\t':         editor_complete(&ed, previous == '\t'); break;
+            case CTRL('P'):
+                if (ed.browsed > 0) editor_browse(&ed, ed.browsed - 1);
+                break;
+            case CTRL('N'):
+                if (ed.browsed < HISTORY.count){
+                    editor_browse(&ed, ed.browsed + 1);
+                }
+                break;
+            default:
+                if ((unsigned char) key >= ' ' && key != KEY_BACKSPACE
+                        && !editor_insert(&ed, (char) key)){
+                    eof = true;  // OOM
+                    done = true;
+                }
+                break;
+        }
+        if (!done) editor_redraw(&ed);
+    }
+
+    printf("\n");
+    fflush(stdout);
+    tcsetattr(STDIN_FILENO, TCSADRAIN, &ed.terminal);
+    free(ed.typed);
+
+    (*buffer)[ed.len] = 0;
+    *len = ed.len;
+    return eof ? NULL : *buffer;
+}
+
+
+/**
+ * Waits for the next key, going on with the background jobs meanwhile.
+ * A job that ends is reported at once, above the line, which is then
+ * redrawn (KEY_REDRAW). The escape sequences of the arrows and of
+ * Home/End/Delete are turned into the control keys that do the same.
+ * @return  the key, or -1 at the end of the input.
+ * */
+int editor_key (){
+    unsigned char c;
+    while (true){
+        int event = wait_bg_jobs(true);
+        if (event == EVENT_CHILD){
+            printf("\r\x1b[K");
+            fflush(stdout);
+            report_bg_jobs();
+            return KEY_REDRAW;
+        }
+        if (event != EVENT_INPUT){
+            continue;  // Ctrl-C is a key here: a signal came from elsewhere
+        }
+        ssize_t got = read(STDIN_FILENO, &c, 1);
+        if (got == 1){
+            return c == KEY_ESCAPE ? editor_escape() : c;
+        }
+        if (got == 0 || errno != EINTR){
+            return -1;
+        }
+    }
+}
+
+
+int editor_escape (){
+    unsigned char seq[3];
+    if (read(STDIN_FILENO, seq, 1) != 1 || (seq[0] != '[' && seq[0] != 'O')
+            || read(STDIN_FILENO, seq + 1, 1) != 1){
+        return KEY_ESCAPE;
+    }
+    switch (seq[1]){
+        case 'A':   return CTRL('P');
+        case 'B':   return CTRL('N');
+        case 'C':   return CTRL('F');
+        case 'D':   return CTRL('B');
+        case 'H':   return CTRL('A');
+        case 'F':   return CTRL('E');
+        case '3':   // Delete is "\e[3~"
+            if (read(STDIN_FILENO, seq + 2, 1) == 1 && seq[2] == '~'){
+                return CTRL('D');
+            }
+            return KEY_ESCAPE;
+        default:    return KEY_ESCAPE;
+    }
+}
+
+
+/**
+ * Incremental search, newest first, like Ctrl-R in bash: every key typed
+ * narrows the search, Ctrl-R again finds an older match. Enter runs the
+ * match, Ctrl-G gives the line back as it was, and any other key leaves
+ * the match on the line to be edited.
+ * @return  the key that ended the search, to be handled by the caller.
+ * */
+int editor_search (Line_editor* ed){
+    char   query[SEARCH_QUERY_MAX];
+    size_t query_len = 0;
+    size_t match = HISTORY.count;   // nothing found yet
+    bool   failed = false;
+
+    char*  before = malloc(ed->len + 1);
+    size_t before_len = ed->len;
+    if (before == NULL){
+        return 0;
+    }
+    memcpy(before, *ed->buffer, ed->len);
+
+    int key;
+    while (true){
+        printf("\r");
+        printf(failed ? SEARCH_FAILED_PROMPT : SEARCH_PROMPT,
+               (int) query_len, query);
+        printf("%.*s\x1b[K", (int) ed->len, *ed->buffer);
+        fflush(stdout);
+
+        key = editor_key();
+        size_t from;
+        if (key == KEY_REDRAW){
+            continue;
+        } else if (key == CTRL('R')){
+            from = match;           // an older one
+        } else if ((key == KEY_BACKSPACE || key == CTRL('H'))
+                   && query_len > 0){
+            query_len--;
+            from = HISTORY.count;   // the newest again
+        } else if (key >= ' ' && key < KEY_BACKSPACE
+                   && query_len < SEARCH_QUERY_MAX){
+            query[query_len++] = (char) key;
+            from = match < HISTORY.count ? match + 1 : HISTORY.count;
+        } else {
+            break;
+        }
+
+        size_t found = query_len == 0 ? HISTORY_NOT_FOUND
+                     : history_search(&HISTORY, query, query_len, false, from);
+        failed = query_len > 0 && found == HISTORY_NOT_FOUND;
+        if (found != HISTORY_NOT_FOUND){
+            match = found;
+            size_t      len;
+            const char* entry = history_entry(&HISTORY, found, &len);
+            if (!editor_set(ed, entry, len)){
+                key = -1;
+                break;
+            }
+        }
+    }
+
+    if (key == CTRL('G') && !editor_set(ed, before, before_len)){
+        key = -1;
+    }
+    free(before);
+    if (key == CTRL('G')){
+        key = 0;
+    }
+    if (match < HISTORY.count){
+        ed->browsed = match;
+    }
+    return key;
+}
+
+
+/**
+ * Replaces the whole line, the cursor at its end.
+ * */
+bool editor_set (Line_editor* ed, const char* text, size_t len){
+    if (len + 1 > *ed->capacity){
+        char* buffer = realloc(*ed->buffer, len + 1);
+        if (buffer == NULL){
+            return false;
+        }
+        *ed->buffer = buffer;
+        *ed->capacity = len + 1;
+    }
+    memmove(*ed->buffer, text, len);
+    ed->len = len;
+    ed->cursor = len;
+    return true;
+}
+
+
+bool editor_insert (Line_editor* ed, char c){
+    if (ed->len + 2 > *ed->capacity){
+        size_t capacity = *ed->capacity * 2 + 64;
+        char* buffer = realloc(*ed->buffer, capacity);
+        if (buffer == NULL){
+            return false;
+        }
+        *ed->buffer = buffer;
+        *ed->capacity = capacity;
+    }
+    char* line = *ed->buffer;
+    memmove(line + ed->cursor + 1, line + ed->cursor, ed->len - ed->cursor);
+    line[ed->cursor++] = c;
+    ed->len++;
+    return true;
+}
+
+
+void editor_erase (Line_editor* ed, size_t from, size_t to){
+    char* line = *ed->buffer;
+    memmove(line + from, line + to, ed->len - to);
+    ed->len -= to - from;
+    ed->cursor = from;
+}
+
+
+/**
+ * Shows an entry of the history (or, past the last one, what was being
+ * typed before going up).
+ * */
+void editor_browse (Line_editor* ed, size_t entry){
+    if (ed->browsed == HISTORY.count){
+        free(ed->typed);
+        ed->typed = malloc(ed->len + 1);
+        if (ed->typed == NULL){
+            return;
+        }
+        memcpy(ed->typed, *ed->buffer, ed->len);
+        ed->typed_len = ed->len;
+    }
+
+    size_t      len = ed->typed_len;
+    const char* text = ed->typed;
+    if (entry < HISTORY.count){
+        text = history_entry(&HISTORY, entry, &len);
+    }
+    if (text != NULL && editor_set(ed, text, len)){
+        ed->browsed = entry;
+    }
+}
+
+
+void editor_redraw (const Line_editor* ed){
+    printf("\r%s%.*s\x1b[K", ed->prompt, (int) ed->len, *ed->buffer);
+    if (ed->cursor < ed->len){
+        printf("\x1b[%zuD", ed->len - ed->cursor);
+    }
+    fflush(stdout);
+}
+
+
+/**
+ * Completes the word before the cursor (see "completion.h"): a command
+ * name when it is where a command starts, a file name otherwise. When
+ * there is nothing to add, a second Tab lists the candidates.
+ * */
+void editor_complete (Line_editor* ed, bool again){
+    const char* line = *ed->buffer;
+    size_t      start = ed->cursor;
+    while (start > 0 && line[start - 1] != ' ') start--;
+
+    token_kind previous = TK_SEP;
+    for (size_t i = 0; i < start;){
+        if (line[i] == ' '){
+            i++;
+            continue;
+        }
+        size_t len = 0;
+        while (i + len < start && line[i + len] != ' ') len++;
+        previous = classify_word(line + i, len, previous);
+        i += len;
+    }
+    bool command = starts_command(previous);
+
+    char   insert[PATH_MAX];
+    size_t insert_len;
+    size_t count = complete_word(line + start, ed->cursor - start, command,
+                                 insert, sizeof(insert), &insert_len);
+    if (count == 0){
+        printf("\a");
+    } else if (insert_len > 0){
+        for (size_t i = 0; i < insert_len; i++){
+            if (!editor_insert(ed, insert[i])) break;
+        }
+    } else if (again){
+        list_completions(*ed->buffer + start, ed->cursor - start, command);
+    } else {
+        printf("\a");
+    }
+}
+
+
+#endif //TESTSHELL_LINE_EDITOR_H
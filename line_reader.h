@@ -0,0 +1,159 @@
+#ifndef TESTSHELL_LINE_READER_H
+#define TESTSHELL_LINE_READER_H
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define READ_BLOCK_SIZE (256 * 1024)
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * Reads a file descriptor by large blocks and cuts them into lines, in
+ * place. Used when the commands come from a script instead of a user:
+ * there is one `read()` per block instead of one per line, and no
+ * allocation once the buffer is as big as the longest line.
+ * */
+typedef struct Line_reader {
+    int         fd;
+    char*       buffer;
+    size_t      capacity;
+    size_t      start;          // first byte of the next line
+    size_t      end;            // end of the bytes read so far
+    bool        eof;
+} Line_reader;
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+void  reader_init      (Line_reader* reader, int fd);
+char* reader_next_line (Line_reader* reader, size_t* len);
+bool  reader_fill      (Line_reader* reader);
+
+
+
+
+/* ********************************************************
+ * READING FUNCTIONS
+ * ****************************************************** */
+
+
+void reader_init (Line_reader* reader, int fd){
+    reader->fd = fd;
+    reader->buffer = NULL;
+    reader->capacity = 0;
+    reader->start = 0;
+    reader->end = 0;
+    reader->eof = false;
+}
+
+
+/**
+ * Returns the next line, without its '\n' and terminated by a '\0'
+ * written in the buffer. The line stays valid until the next call.
+ * @param   len     set to the length of the line.
+ * @return  the line, or NULL at the end of the input (or on error).
+ * */
+char* reader_next_line (Line_reader* reader, size_t* len){
+    size_t scanned = reader->start;
+
+    while (true){
+        char* line = reader->buffer + reader->start;
+        char* newline = reader->end > scanned   // no buffer before a read
+                        ? memchr(reader->buffer + scanned, '\n',
+                                 reader->end - scanned)
+                        : NULL;
+
+        if (newline != NULL){
+            *newline = 0;
+            *len = (size_t) (newline - line);
+            reader->start += *len + 1;
+            return line;
+        }
+
+        if (reader->eof){
+            if (reader->start == reader->end){
+                return NULL;
+            }
+            // last line without '\n': `reader_fill()` kept a byte for '\0'
+            reader->buffer[reader->end] = 0;
+            *len = reader->end - reader->start;
+            reader->start = reader->end;
+            return line;
+        }
+
+        scanned = reader->end - reader->start;  // no '\n' before that
+        if (!reader_fill(reader)){
+            return NULL;
+        }
+        scanned += reader->start;
+    }
+}
+
+
+/**
+ * Moves the unfinished line to the front of the buffer (growing it if the
+ * line fills it) and reads one more block after it.
+ * @return  false on a read error or when out of memory.
+ * */
+bool reader_fill (Line_reader* reader){
+    size_t pending = reader->end - reader->start;
+    if (reader->start > 0){
+        memmove(reader->buffer, reader->buffer + reader->start, pending);
+        reader->start = 0;
+        reader->end = pending;
+    }
+
+    // always room for a block, plus the '\0' of a last line without '\n'
+    if (reader->capacity - reader->end < READ_BLOCK_SIZE + 1){
+        size_t capacity = reader->capacity ? reader->capacity * 2
+                                           : READ_BLOCK_SIZE + 1;
+        while (capacity - reader->end < READ_BLOCK_SIZE + 1) capacity *= 2;
+        char* buffer = realloc(reader->buffer, capacity);
+        if (buffer == NULL){
+            return false;  // OOM
+        }
+        reader->buffer = buffer;
+        reader->capacity = capacity;
+    }
+
+    ssize_t got;
+    do {
+        got = read(reader->fd, reader->buffer + reader->end,
+                   reader->capacity - reader->end - 1);
+    } while (got < 0 && errno == EINTR);
+
+    if (got < 0){
+        return false;
+    }
+    if (got == 0){
+        reader->eof = true;
+    }
+    reader->end += (size_t) got;
+    return true;
+}
+
+
+#endif //TESTSHELL_LINE_READER_H
@@ -3,22 +3,31 @@ auteurs:    Jérémi Grenier-Berthiaume
             Olivier Lepage-Applin
 date:       8 Février 2019
 problèmes connus:
-    - `optimizer_cnt` is lazy: a solution that wouldn't use strtok is possible
-    - `debug_free` is lazy: a better solution could have been used
     - there could be even MORE error management
     - maybe we should have written it all in French..?
     - two lines dared to adventure beyond the almighty 80-chars-boundary
   */
 
 
+#define _GNU_SOURCE  // pipe2() and F_SETPIPE_SZ
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <sys/wait.h>
+#include <sys/resource.h>
 #include <stdbool.h>
 #include <fcntl.h>
 #include <signal.h>
+#include <limits.h>
+#include <errno.h>
+
+
+/*
+ * Chrome trace-event export (`--trace=FILE`).
+ */
+#include "trace.h"
 
 
 /*
@@ -27,6 +36,18 @@ problèmes connus:
 #include "expression.h"
 
 
+/*
+ * Already parsed command lines.
+ */
+#include "ast_cache.h"
+
+
+/*
+ * Block reading of the scripts.
+ */
+#include "line_reader.h"
+
+
 /*
  * The "FAILED_EXECVP" value is returned by a child when `execvp`
  * did not successfully run the command.
@@ -35,153 +56,322 @@ problèmes connus:
 
 
 /*
- * Updated as the PID of the last child process created by a
- * sequential command (no trailing '&').
+ * Capacity asked for the pipes between the stages of a pipeline (the
+ * kernel default is 64 KiB). Bigger pipes mean fewer context switches
+ * between a fast writer and its reader.
+ */
+#define PIPE_BUFFER_SIZE (1024 * 1024)
+
+
+/*
+ * The PID of the foreground child that Ctrl-Z stops, while the shell
+ * waits for it; 0 otherwise.
+ */
+pid_t CURR_CHILD = 0;
+
+
+/*
+ * Input line, reused from one prompt to the next. The words of the parsed
+ * line point directly inside of it.
+ */
+char*  INPUT_LINE = NULL;
+size_t INPUT_CAPACITY = 0;
+
+
+/*
+ * False when the commands come from a script file or from a stdin that
+ * is not a terminal: no prompt is shown and the input is read by blocks.
+ */
+bool        INTERACTIVE = true;
+Line_reader SCRIPT;
+
+
+/*
+ * True in the forked copies of the shell that run a background job or a
+ * stage of a pipeline: their `exit` only ends the copy.
+ */
+bool SUBSHELL = false;
+
+
+/*
+ * What Ctrl-C and Ctrl-\ did before `remove_C_handlers()` ignored them.
+ */
+struct sigaction SAVED_INT;
+struct sigaction SAVED_QUIT;
+
+
+/*
+ * Shown before every line typed by the user.
  */
-volatile pid_t CURR_CHILD = 0;
+#define PROMPT "shell> "
+
+
+/*
+ * Command-line options.
+ */
+#define USAGE "usage: %s [--spawn=fork|vfork|posix_spawn|server] " \
+              "[--ast-cache=N] [--trace=FILE] [--history=FILE] [--xargs] " \
+              "[script]\n"
 
 
 /*
  * Function declarations.
  */
 
-Split_line* form_split_line(char**, int);
-char** query_and_split_input();
-size_t optimizer_cnt(const char*);
-int count_words(char**);
-char** split_str (const char*, const char[]);
-void debug_free(char**);
-void set_up_handlers();
-void z_handler();
-void ctrl_Z_handler(int);
+Split_line* form_split_line(char**, token_kind*, int);
+Split_line* query_and_split_input();
+char* read_line(size_t*);
+Split_line* split_str (char*, size_t, const char[]);
+void set_up_signals();
 void remove_Z_handler();
-void set_up_reaper();
-void zombie_handler(int);
+void restore_Z_handler();
+void remove_C_handlers();
+void restore_C_handlers();
+void child_reaped(pid_t, int, const struct rusage*);
 void run_bg_cmd(Split_line*);
 bool writeOutputInFile(const char*);
 int run_command(Command*);
+Command* expand_command(Command*);
+int run_batches(Command*);
+pid_t start_command(Command*, int, int, bool*);
+bool command_status(Command*, int, bool);
+int run_pipeline(Expression*);
+pid_t start_stage(Expression*, int, int, int);
 void run_fg_cmd(Split_line*);
+Expression* get_ast(Split_line*, int);
+bool parse_count(const char*, size_t*);
+void parse_options(int, char**);
+void shell_exit(int);
+
+
+/*
+ * The epoll loop the shell sleeps in: the input, the signals (read from a
+ * signalfd) and the children (through their pidfds).
+ */
+#include "event_loop.h"
+
+
+/*
+ * Process creation (fork, vfork, posix_spawn or the fork server).
+ */
+#include "spawn_engine.h"
+#include "fork_server.h"
+
+
+/*
+ * Expansion of `*`, `?`, `[...]` and `**` in the words of a command.
+ */
+#include "glob.h"
+
+
+/*
+ * Shell variables, the environment of the children, `export` and `unset`.
+ */
+#include "variables.h"
+
+
+/*
+ * Commands too long for one exec, run in batches (`--xargs`).
+ */
+#include "xargs.h"
+
+
+/*
+ * Commands already found in $PATH, and the `hash` builtin.
+ */
+#include "path_cache.h"
+
+
+/*
+ * Resources used by the children, and the `time` keyword.
+ */
+#include "job_usage.h"
+
+
+/*
+ * Compilation of the Syntax Trees, and the loop that runs them: `eval()`.
+ */
+#include "bytecode.h"
+
+
+/*
+ * The `parallel` builtin.
+ */
+#include "parallel.h"
+
+
+/*
+ * Counters and latency histograms, and the `shellstat` builtin.
+ */
+#include "shell_stats.h"
+
+
+/*
+ * Persistent history, `!` recall and the `history` builtin.
+ */
+#include "history.h"
+
+
+/*
+ * Commands run by the shell itself: true, false, echo, cd, pwd, exit, hash,
+ * parallel, shellstat, history, export and unset.
+ */
+#include "builtins.h"
+
+
+/*
+ * Background jobs, walked by the shell itself.
+ */
+#include "background.h"
+
+
+/*
+ * Tab completion of the command names and of the file names.
+ */
+#include "completion.h"
+
+
+/*
+ * Editing of the line typed at the prompt, with the history.
+ */
+#include "line_editor.h"
 
 
 /*
  * Utils.
  */
 
-Split_line* form_split_line(char** args, int wordc) {
-    /// Properly sets up a `Split_line` with the char** obtained from query.
+Split_line* form_split_line(char** args, token_kind* kinds, int wordc) {
+    /// Properly sets up a `Split_line` with the words obtained from query.
 
-    Split_line* sl = malloc(sizeof(Split_line));
+    Split_line* sl = arena_alloc(&LINE_ARENA, sizeof(Split_line));
     if(sl == NULL) return NULL;  // OOM
     sl->content = args;
+    sl->kinds = kinds;
     sl->size = wordc;
-    sl->thread_flag = ((strcmp(args[wordc-1], "&")) == 0); // find trailing '&'
+    sl->thread_flag = wordc > 0 && kinds[wordc-1] == TK_BACK; // trailing '&'
     return sl;
 }
 
-char** query_and_split_input() {
-    /// Asks for a command. Ignores anything beyond first '\n'.
-    /// Returns the array resulting from splitting the input.
-
-    /* Prompting for command. */
-    printf ("\nshell> ");  // `\n` to ensure the printf-buffer is emptied
+Split_line* query_and_split_input() {
+    /// Asks for a command until a non-blank one is given. Ignores anything
+    /// beyond first '\n'. Returns the line resulting from splitting the
+    /// input, or NULL at the end of the input.
 
-    char* input_str = NULL;
-    size_t buffer_size;
-    if (getline(&input_str, &buffer_size, stdin) == -1) {
-        free(input_str);
-        return NULL;
-    }
-    input_str[strcspn(input_str, "\n")] = 0;  // crop to first new-line
+    Split_line* line = NULL;
 
-    /* Splitting the input string. */
-    char** args;
-    if ((args = split_str (input_str, " ")) == 0) {
-        free(input_str);
-        return query_and_split_input();
-    } else {
-        free(input_str);
-        return args;
-    }
-}
-
-size_t optimizer_cnt(const char *str) {
-    /// Returns min(1, #words).
+    while (line == NULL || line->size == 0) {
+        size_t len;
+        double start = trace_start();
+        char* input = read_line(&len);
+        trace_span("read", start, NULL, 0);
+        if (input == NULL) {
+            return NULL;
+        }
+        SHELL_STATS.lines_read++;
 
-    char copied_str[strlen(str)+1];
-    strcpy(copied_str, str);
-    size_t count = 1;
+        /* `!prefix` recall, then the line goes in the history. */
+        if (INTERACTIVE) {
+            input = history_expand(&HISTORY, input, &len);
+            if (input == NULL) {
+                continue;  // no such entry
+            }
+            history_add(&HISTORY, input, len);
+        }
 
-    strtok(copied_str, " ");
-    while(strtok(NULL, " ") != 0) {
-        count++;
+        /* Splitting the input string. */
+        start = trace_start();
+        line = split_str (input, len, " ");
+        trace_span("tokenize", start, NULL, 0);
+        if (line == NULL) {
+            return NULL;  // OOM
+        }
     }
 
-    return count;
+    return line;
 }
 
-int count_words(char** tab) {
-    /// Counts the amount of words in the split line (parsed from input by user).
-    int tmp = -1;
+char* read_line(size_t* len) {
+    /// Returns the next line of input without its '\n', or NULL at the end.
+    /// The user gets a prompt; a script is read by blocks instead.
 
-    while(true) {
-        tmp++;
-        if(tab[tmp] == NULL)
-            break;
+    if (!INTERACTIVE) {
+        return reader_next_line(&SCRIPT, len);
     }
 
-    return tmp;
-}
-
-char** split_str (const char* str, const char delim[]) {
-    /// Returns a list of pointers to strings that came from splitting the input.
-    /// Returns NULL in case of error.
-
-    char* copied_input = strdup(str);  // because 'strtok()' alters the string
-    if (copied_input == 0) return NULL;  // OOM
+    /* Prompting for command. */
+    printf ("\n" PROMPT);  // `\n` to ensure the printf-buffer is emptied
+    fflush(stdout);
+    if (LINE_EDITING) {
+        return edit_line(PROMPT, &INPUT_LINE, &INPUT_CAPACITY, len);
+    }
 
-    /* Counting words to optimize allocated's memory size. */
-    size_t nwords = optimizer_cnt(copied_input);
-    char** result;
-    if ((result = malloc((nwords+1) * sizeof(char *))) == 0) return NULL; // OOM
+    /* The jobs go on while the user types; the ones that end are reported
+     * at once. Ctrl-C drops the line (the terminal already has). */
+    int event;
+    while ((event = wait_bg_jobs(true)) != EVENT_INPUT) {
+        printf("\n");
+        fflush(stdout);
+        if (event == EVENT_CHILD) {
+            report_bg_jobs();
+        }
+        printf(PROMPT);
+        fflush(stdout);
+    }
 
-    /* Obtaining first word. */
-    char* token = strtok (copied_input, delim);
-    if (token == NULL) {
-        free(result);
-        free(copied_input);
-        return NULL;
-    } else if ((result[0] = strdup (token)) == 0) {  // OOM
-        free(result);
-        free(copied_input);
+    ssize_t read = getline(&INPUT_LINE, &INPUT_CAPACITY, stdin);
+    if (read == -1) {
         return NULL;
     }
+    if (read > 0 && INPUT_LINE[read-1] == '\n') {
+        INPUT_LINE[--read] = 0;  // crop the new-line
+    }
+    *len = (size_t) read;
+    return INPUT_LINE;
+}
 
-    /* To populate the whole array with the rest of the words. */
-    int tmp = 0;
-    while ((token = strtok (NULL, delim)) != NULL) {
-        if ((result[++tmp] = strdup (token)) == 0) {
-            /* In case of OOM, each past array must also be freed. */
-            while (tmp-- != 0) {
-                free(result[tmp]);
+Split_line* split_str (char* str, size_t len, const char delim[]) {
+    /// Splits `str` in place, in a single pass: delimiters are overwritten by
+    /// '\0' and the words point inside `str`, which must outlive them. The
+    /// kind of each word is given by `classify_word()` as soon as it ends.
+    /// Only the arrays are allocated (in the LINE_ARENA).
+    /// Returns NULL in case of OOM.
+
+    bool is_delim[UCHAR_MAX + 1] = {false};
+    for (const char* d = delim; *d != 0; d++) {
+        is_delim[(unsigned char) *d] = true;
+    }
+    is_delim[0] = true;  // the word before the final '\0' must end too
+
+    /* At most one word every two characters, plus the final NULL. */
+    size_t max_words = len/2 + 2;
+    char** result = arena_alloc(&LINE_ARENA, max_words * sizeof(char *));
+    token_kind* kinds = arena_alloc(&LINE_ARENA,
+                                    max_words * sizeof(token_kind));
+    if (result == 0 || kinds == 0) return NULL;  // OOM
+
+    int count = 0;
+    size_t word_start = 0;
+    bool in_word = false;
+    token_kind previous = TK_SEP;  // the line starts a new command
+    for (size_t i = 0; i <= len; i++) {  // `str[len]` is the final '\0'
+        if (is_delim[(unsigned char) str[i]]) {
+            if (in_word) {
+                previous = classify_word(str + word_start, i - word_start,
+                                         previous);
+                kinds[count++] = previous;
+                in_word = false;
             }
-            free(result);
-            free(copied_input);
-            return NULL;
+            str[i] = 0;
+        } else if (!in_word) {
+            result[count] = str + i;
+            word_start = i;
+            in_word = true;
         }
     }
 
-    result[++tmp] = NULL;  /* Must end with NULL */
-
-    free(copied_input);
-    return result;
-}
-
-void debug_free(char** args) {
-    /// Lazy function to ensure `args` is freed properly.
-
-    int count = count_words(args);
-    Split_line* line = form_split_line(args, count);
-    free_split_line(line);
+    result[count] = NULL;  /* Must end with NULL */
+    return form_split_line(result, kinds, count);
 }
 
 
@@ -189,38 +379,64 @@ void debug_free(char** args) {
  * Bonus 2
  */
 
-void set_up_handlers() {
-    /// To initialize the signal handlers.
-
-    set_up_reaper();
-    z_handler();
+void set_up_signals() {
+    /// The signals of the shell stay blocked and are read from the
+    /// EVENT_LOOP: SIGCHLD, Ctrl-Z (Bonus #2) and, at a terminal, Ctrl-C,
+    /// which is then only for the foreground child.
+
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGCHLD);
+    sigaddset(&signals, SIGTSTP);
+    if (INTERACTIVE) {
+        sigaddset(&signals, SIGINT);
+    }
+    if (!event_loop_open(&EVENT_LOOP, &signals)) {
+        perror("event loop");
+        exit(EXIT_FAILURE);
+    }
 }
 
-void z_handler() {
-    /// To treat Ctrl-Z (Bonus #2).
+void remove_Z_handler() {
+    /// Used to ensure a child-process will not detect the Ctrl-Z.
 
-    struct sigaction bonus2_signal;
-    bonus2_signal.sa_handler = &ctrl_Z_handler;
-    sigemptyset(&bonus2_signal.sa_mask);
-    bonus2_signal.sa_flags = SA_RESTART;
-    sigaction(SIGTSTP, &bonus2_signal, NULL);
+    struct sigaction signal_ignore;
+    signal_ignore.sa_handler = SIG_IGN;
+    sigemptyset(&signal_ignore.sa_mask);
+    signal_ignore.sa_flags = 0;
+    sigaction(SIGTSTP, &signal_ignore, NULL);
 }
 
-void ctrl_Z_handler(int sigNo) {
-    /// Stops the process identified by the CURR_CHILD pid.
+void restore_Z_handler() {
+    /// Undoes `remove_Z_handler()`. The shell itself never stops: SIGTSTP
+    /// stays blocked, and is read from the EVENT_LOOP.
 
-    if(CURR_CHILD != 0)  // prevents crash if there wasn't any child created yet
-        kill(CURR_CHILD, SIGSTOP);  // triggers the waitpid in the parent
+    struct sigaction signal_default;
+    signal_default.sa_handler = SIG_DFL;
+    sigemptyset(&signal_default.sa_mask);
+    signal_default.sa_flags = 0;
+    sigaction(SIGTSTP, &signal_default, NULL);
 }
 
-void remove_Z_handler() {
-    /// Used to ensure a child-process will not detect the Ctrl-Z.
+void remove_C_handlers() {
+    /// Used to ensure a background child will not get the Ctrl-C or the
+    /// Ctrl-\ typed for the foreground: like Ctrl-Z, they stay ignored
+    /// through the exec, and in the children of a forked copy.
 
     struct sigaction signal_ignore;
     signal_ignore.sa_handler = SIG_IGN;
     sigemptyset(&signal_ignore.sa_mask);
     signal_ignore.sa_flags = 0;
-    sigaction(SIGTSTP, &signal_ignore, NULL);
+    sigaction(SIGINT, &signal_ignore, &SAVED_INT);
+    sigaction(SIGQUIT, &signal_ignore, &SAVED_QUIT);
+}
+
+void restore_C_handlers() {
+    /// Undoes `remove_C_handlers()`. At a terminal SIGINT stays blocked, and
+    /// is read from the EVENT_LOOP.
+
+    sigaction(SIGINT, &SAVED_INT, NULL);
+    sigaction(SIGQUIT, &SAVED_QUIT, NULL);
 }
 
 
@@ -228,65 +444,136 @@ void remove_Z_handler() {
  * Q2.4
  */
 
-void set_up_reaper() {
-    /// To reap zombie-child processes.
+void child_reaped(pid_t pid, int status, const struct rusage* usage) {
+    /// Called by the EVENT_LOOP for every child it reaps: keeps the status
+    /// and the resource usage of the WATCHED ones and of the background
+    /// jobs. Any other child is forgotten.
 
-    struct sigaction zombie_reaper;
-    zombie_reaper.sa_handler = &zombie_handler;
-    sigemptyset(&zombie_reaper.sa_mask);
-    zombie_reaper.sa_flags = SA_RESTART | SA_NOCLDSTOP;
-    sigaction(SIGCHLD, &zombie_reaper, NULL);
+    if (!watch_child(pid, status, usage)) {
+        bg_job_reaped(pid, status, usage);
+    }
 }
 
-void zombie_handler(int sigNo) {
-    /// Reaps the processes it receives signals from.
+bool child_stopped(Watched_child* child) {
+    /// Tells if `child` was stopped, in which case it is marked as done with
+    /// the status of the stop. A pidfd only says when a child ends, so this
+    /// is asked after every SIGCHLD.
 
-    int status;
-    while ((waitpid(-1, &status, WNOHANG)) > 0)
-        ;  // always reap children
+    int           status;
+    struct rusage usage;
+    if (child->pid <= 0 || child->done
+            || wait4(child->pid, &status, WNOHANG | WUNTRACED, &usage)
+               != child->pid) {
+        return false;
+    }
+    if (!WIFSTOPPED(status)) {
+        child_reaped(child->pid, status, &usage);  // ended meanwhile
+        return false;
+    }
+    child->status = status;
+    child->usage = usage;
+    child->done = true;
+    return true;
+}
+
+bool wait_children(Watched_child* children, int count) {
+    /// Sleeps in the EVENT_LOOP until every one of the `children` has ended
+    /// (a PID of 0 is skipped), while the background jobs go on. Ctrl-Z
+    /// stops the last one, and the others with it: they are then left
+    /// behind, and reaped whenever they end. Returns false if stopped.
+
+    WATCHED = children;
+    WATCHED_COUNT = count;
+    CURR_CHILD = children[count-1].pid;
+
+    bool stopped = false;
+    int  waited = 0;  // the children before it are done
+    while (!stopped) {
+        while (waited < count && (children[waited].pid <= 0
+                                  || children[waited].done)) {
+            waited++;
+        }
+        if (waited == count) {
+            break;
+        }
+
+        int events = event_loop_wait(&EVENT_LOOP, false);
+        if (events < 0) {
+            break;
+        }
+        if ((events & EVENT_SUSPEND) && CURR_CHILD > 0) {
+            kill(CURR_CHILD, SIGSTOP);  // reported by a SIGCHLD
+        }
+        if (events & EVENT_CHILD) {
+            stopped = child_stopped(&children[count-1]);
+            supervise_bg_jobs();
+        }
+    }
+
+    for (int i = 0; stopped && i < count; i++) {
+        if (children[i].pid > 0 && !children[i].done) {
+            kill(children[i].pid, SIGSTOP);
+        }
+    }
+    WATCHED = NULL;
+    WATCHED_COUNT = 0;
+    CURR_CHILD = 0;
+    return !stopped;
 }
 
 void run_bg_cmd(Split_line *line) {
-    /// To execute a chain of command(s) in the background.
+    /// To execute a chain of command(s) in the background. The shell walks
+    /// the chain itself from its main loop (see "background.h"), so a plain
+    /// command costs a single process. A copy of the shell only runs the
+    /// whole chain when the table of the jobs is full.
 
     /* To replace the trailing '&' from the command. */
-    free(line->content[line->size-1]);
     line->content[line->size-1] = NULL;
-    Expression* ast = parse_line(line, 0, line->size - 2);
+    Expression* ast = get_ast(line, line->size - 2);
+    if (ast == NULL) {
+        return;  // the syntax error was reported
+    }
+
+    /* The children must not print what the shell has buffered. */
+    fflush(stdout);
+
+    SHELL_STATS.bg_started++;
+    Bg_job* job = bg_job_new(ast);
+    if (job != NULL) {
+        bg_job_run(job, job->root);
+        return;
+    }
 
-    /* Forking. */
     pid_t    pid;
     pid = fork();
 
-    if (pid < 0) {  // error while forking
-        free_split_line(line);
-
-    } else if (pid == 0) {  // child
+    if (pid == 0) {  // child
         remove_Z_handler();  // prevent Cltr-Z triggers in child
+        remove_C_handlers();  // nor Ctrl-C, which is for the foreground
+        event_loop_forked(&EVENT_LOOP);
+        SUBSHELL = true;
+        trace_track("background");
 
         // todo: if "cat" or "vi", stop process ? (bonus 1)
 
         /* Executing the command(s). */
-        eval(ast);
-
-        /* Child process failed. */
-        free_split_line(line);
-        destroy_expression(ast);
-        exit(-1);
-
-
-    } else {  // back in parent
-
-        /* Freeing memory. */
-        free_split_line(line);
-        destroy_expression(ast);
+        double start = trace_start();
+        int success = eval(ast);
+        trace_span("background", start, line->content, 0);
+        exit(success ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    if (pid > 0) {
+        event_loop_watch(&EVENT_LOOP, pid);
+        bg_job_forked(pid);  // reported like the others
     }
+
+    /* The parent's copy of the line goes with the arena reset. */
 }
 
 bool writeOutputInFile(const char* output) {
     /// Redirecting `stdout` to a file-descriptor.
 
-    int fileDescriptor = open(output,O_WRONLY|O_CREAT, S_IRWXU|S_IRWXG|S_IRWXO);
+    int fileDescriptor = open(output, REDIRECT_FLAGS, REDIRECT_MODE);
     if (fileDescriptor < 0)         return false;    // in case of error
     if (dup2(fileDescriptor,1) < 0) return false;    // in case of error
     if (close(fileDescriptor) < 0)  return false;    // in case of error
@@ -301,98 +588,494 @@ bool writeOutputInFile(const char* output) {
 int run_command(Command* cmd) {
     /// Called throughout the recursion that evaluates every single command.
 
-    /* Forking. */
-    int         status;
-    CURR_CHILD = fork();
+    cmd = expand_command(cmd);
+    if (cmd == NULL) {
+        perror("malloc error expand_command");
+        return false;
+    }
+    if (cmd->cmd[0] == NULL) {  // only assignments, or nothing left at all
+        for (char** word = cmd->env; word != NULL && *word != NULL; word++) {
+            if (!var_assign(&VARS, *word, false)) {
+                perror("malloc error run_command");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const Builtin* builtin = find_builtin(cmd->cmd[0]);
+    if (builtin != NULL) {
+        char** saved = var_push(&VARS, cmd->env);
+        if (saved == NULL && cmd->env != NULL) {
+            perror("malloc error run_command");
+            return false;
+        }
+        int result = run_builtin(builtin, cmd);
+        var_pop(&VARS, saved);
+        return result;
+    }
+    if (xargs_needed(cmd)) {
+        return run_batches(cmd);
+    }
+
+    fflush(stdout);  // the shell's own messages come before the child's
+
+    /* Spawning, then waiting for the child. */
+    bool          cached;
+    Watched_child child = {0};
+    child.pid = start_command(cmd, -1, -1, &cached);
+    if (child.pid < 0) {
+        return false;  // same as a FAILED_EXECVP status
+    }
 
-    if (CURR_CHILD < 0) {
+    uint64_t start = stats_now();
+    wait_children(&child, 1);
+    hist_since(&SHELL_STATS.command, start);
+    trace_span("run", start / 1e3, cmd->cmd, child.pid);
+    add_usage(&CHILD_USAGE, &child.usage);
+
+    return command_status(cmd, child.status, cached);
+}
+
+Command* expand_command(Command* cmd) {
+    /// Gives the words `cmd` stands for once its variables and its patterns
+    /// are expanded, in that order. The '>' file only gets the variables.
+    /// Returns NULL if memory is lacking.
+
+    cmd = var_command(cmd);
+    return cmd != NULL ? glob_command(cmd) : NULL;
+}
+
+int run_batches(Command* cmd) {
+    /// Runs a command whose words do not fit in one exec like xargs would:
+    /// in as few batches as possible, one after the other, each one with
+    /// the words up to the "--" (see `xargs_fixed()`) and the next part of
+    /// the list.
+    /// A '>' is opened once, for all of them. Returns true if every batch
+    /// succeeded; a batch killed or stopped ends the command.
+
+    int argc = 0;
+    while (cmd->cmd[argc] != NULL) argc++;
+    int    fixed = xargs_fixed(cmd->cmd);
+    size_t room = xargs_room(cmd);
+    for (int i = 0; i < fixed && i < argc; i++) {
+        size_t size = xargs_word_size(cmd->cmd[i]);
+        room = room > size ? room - size : 0;
+    }
+
+    char** words = arena_alloc(&LINE_ARENA, (argc + 1) * sizeof(char*));
+    if (words == NULL) {
+        perror("malloc error run_batches");
         return false;
+    }
+    memcpy(words, cmd->cmd, fixed * sizeof(char*));
+    Command batch = {words, false, NULL, cmd->env};
+
+    int fd_out = -1;
+    if (cmd->redirect_flag) {
+        fd_out = open(cmd->output_file, REDIRECT_FLAGS | O_CLOEXEC,
+                      REDIRECT_MODE);
+        if (fd_out < 0) {
+            perror(cmd->output_file);
+            return false;
+        }
+    }
 
-    } else if (CURR_CHILD == 0) {  // child
-        remove_Z_handler();  // prevent Cltr-Z triggers in child
+    fflush(stdout);
+
+    bool success = true;
+    int  from = fixed;
+    do {
+        int end = fixed < argc ? xargs_batch_end(cmd->cmd, from, room) : argc;
+        memcpy(words + fixed, cmd->cmd + from, (end - from) * sizeof(char*));
+        words[fixed + end - from] = NULL;
+        from = end;
+
+        bool          cached;
+        Watched_child child = {0};
+        child.pid = start_command(&batch, -1, fd_out, &cached);
+        if (child.pid < 0) {
+            success = false;
+            break;
+        }
+        uint64_t start = stats_now();
+        bool ended = wait_children(&child, 1);
+        hist_since(&SHELL_STATS.command, start);
+        trace_span("run", start / 1e3, words, child.pid);
+        add_usage(&CHILD_USAGE, &child.usage);
+
+        success = command_status(&batch, child.status, cached) && success;
+        if (!ended || WIFSIGNALED(child.status)) {
+            break;  // like xargs: the user wants it to stop
+        }
+    } while (from < argc);
+
+    if (fd_out >= 0) close(fd_out);
+    return success;
+}
+
+pid_t start_command(Command* cmd, int fd_in, int fd_out, bool* cached) {
+    /// Finds the file to execute and spawns it, without forking if there is
+    /// none. `fd_in` and `fd_out` are given to the child (-1: the shell's).
+    /// Returns the PID of the child, or -1 if it could not be started.
+
+    uint64_t start = stats_now();
+    const char* path = path_cache_lookup(&PATH_CACHE, cmd->cmd[0], cached);
+    if (path == NULL) {
+        fprintf(stderr, "%s: command not found\n", cmd->cmd[0]);
+        return -1;
+    }
+    char** envp = var_overlay(&VARS, cmd->env);
+    if (envp == NULL) {
+        perror("malloc error start_command");
+        return -1;
+    }
+
+    pid_t pid = spawn_command(cmd, path, envp, fd_in, fd_out);
+
+    /* The cached file is gone: look for the command in $PATH again. */
+    if (pid < 0 && *cached && SPAWN_ERROR == ENOENT) {
+        path_cache_forget(&PATH_CACHE, cmd->cmd[0]);
+        path = path_cache_lookup(&PATH_CACHE, cmd->cmd[0], cached);
+        if (path != NULL) {
+            pid = spawn_command(cmd, path, envp, fd_in, fd_out);
+        }
+    }
+    var_overlay_end(&VARS, cmd->env);
+
+    if (pid > 0) {
+        event_loop_watch(&EVENT_LOOP, pid);
+        SHELL_STATS.commands_spawned++;
+        hist_since(&SHELL_STATS.spawn, start);
+    } else if (path != NULL && SPAWN_ERROR == 0) {
+        SHELL_STATS.fork_failures++;
+        perror(cmd->cmd[0]);
+    } else if (path != NULL) {
+        SHELL_STATS.exec_failures++;
+        fprintf(stderr, "%s: %s%s\n", cmd->cmd[0], strerror(SPAWN_ERROR),
+                SPAWN_ERROR == E2BIG ? xargs_hint(cmd) : "");
+    }
+    trace_span("spawn", start / 1e3, cmd->cmd, pid);
+    return pid;
+}
+
+bool command_status(Command* cmd, int status, bool cached) {
+    /// Managing the 'return status' of an evaluation.
 
-        /* Redirecting output. */
-        if(cmd->redirect_flag) {
-            const char* filePath = cmd->output_file;
-            bool successfulWrite = writeOutputInFile(filePath);
-            if(!successfulWrite) {
-                // todo: in case of error
+    if(WEXITSTATUS(status) == FAILED_EXECVP) {
+        SHELL_STATS.exec_failures++;
+        if (cached) {  // maybe a stale entry (the fork engine can't tell)
+            path_cache_forget(&PATH_CACHE, cmd->cmd[0]);
+        }
+        return false;  // execvp couldn't execute the command properly
+    } else if (status == 0) {
+        return true;
+    } else {
+        return false;
+    }
+}
+
+int run_pipeline(Expression* exp) {
+    /// Runs `a | b | c`: every stage is started before any is waited for,
+    /// each one writing straight into the pipe the next one reads. The data
+    /// never goes through the shell. Returns the status of the last stage.
+
+    int count = 1;
+    for (Expression* e = exp; e->id == PIPE_EXPRESSION;
+                              e = e->node.cond_expr.right) {
+        count++;
+    }
+    Watched_child* stages = arena_alloc(&LINE_ARENA,
+                                        count * sizeof(Watched_child));
+    uint64_t* started_at = arena_alloc(&LINE_ARENA, count * sizeof(uint64_t));
+    if (stages == NULL || started_at == NULL) {
+        perror("malloc error run_pipeline");
+        return false;
+    }
+    memset(stages, 0, count * sizeof(Watched_child));
+
+    fflush(stdout);
+
+    /* Starting the stages, from left to right. */
+    int         started = 0;
+    int         fd_in = -1;  // read end of the previous pipe
+    Expression* rest = exp;
+    while (started < count) {
+        Expression* stage = rest;
+        int         fds[2] = {-1, -1};
+
+        if (rest->id == PIPE_EXPRESSION) {
+            stage = rest->node.cond_expr.left;
+            rest = rest->node.cond_expr.right;
+            if (pipe2(fds, O_CLOEXEC) < 0) {
+                perror("pipe");
+                break;
             }
+            fcntl(fds[1], F_SETPIPE_SZ, PIPE_BUFFER_SIZE);  // best effort
         }
 
-        /* Executing the command(s). */
-        execvp(cmd->cmd[0], cmd->cmd);
+        stages[started].pid = start_stage(stage, fd_in, fds[1], fds[0]);
+        started_at[started++] = stats_now();
 
-        /* Child process failed. */
-        exit(FAILED_EXECVP);
+        if (fd_in >= 0)  close(fd_in);
+        if (fds[1] >= 0) close(fds[1]);
+        fd_in = fds[0];
+    }
+    if (fd_in >= 0) close(fd_in);  // only when a `pipe2()` failed
 
+    /* Waiting for all of them: if the last one gets stopped by Ctrl-Z, the
+     * others are stopped with it instead of being waited for forever. */
+    if (started > 0) {
+        wait_children(stages, started);
+    }
+    for (int i = 0; i < started; i++) {
+        if (stages[i].pid <= 0 || !stages[i].done) continue;
+        hist_since(&SHELL_STATS.command, started_at[i]);  // at most this late
+        trace_span("run", started_at[i] / 1e3, NULL, stages[i].pid);
+        add_usage(&CHILD_USAGE, &stages[i].usage);
+    }
 
-    } else {  // back in parent
-        waitpid(CURR_CHILD, &status, WUNTRACED);  // wait for child to finish
+    return started == count && stages[count-1].pid > 0
+           && stages[count-1].status == 0;
+}
 
-        /* Managing the 'return status' of an evaluation. */
-        if(WEXITSTATUS(status) == FAILED_EXECVP) {
-            return false;  // execvp couldn't execute the command properly
-        } else if (status == 0) {
-            return true;
-        } else {
-            return false;
+pid_t start_stage(Expression* stage, int fd_in, int fd_out, int fd_next) {
+    /// Starts one stage of a pipeline, reading `fd_in` and writing `fd_out`
+    /// (-1: the shell's). A plain command is spawned directly. Anything else
+    /// (an if statement, a `&&` chain, a builtin, a command run in batches)
+    /// is evaluated by a forked copy of the shell, which must not keep
+    /// `fd_next`, the read end of the pipe of the next stage. Returns the
+    /// PID, or -1 if nothing started.
+
+    if (stage->id == COMMAND) {
+        Command* cmd = expand_command(stage->node.cmd_expr);
+        if (cmd == NULL) {
+            perror("malloc error expand_command");
+            return -1;
+        }
+        if (cmd->cmd[0] != NULL && find_builtin(cmd->cmd[0]) == NULL
+                && !xargs_needed(cmd)) {
+            bool cached;
+            return start_command(cmd, fd_in, fd_out, &cached);
         }
     }
+
+    fflush(stdout);  // or the copy would print it again
+    pid_t pid = fork();
+    if (pid == 0) {  // child
+        remove_Z_handler();  // prevent Cltr-Z triggers in child
+        event_loop_forked(&EVENT_LOOP);
+        SUBSHELL = true;
+        trace_track("stage");
+
+        if (fd_next >= 0) close(fd_next);
+        if (!plug_std_fds(fd_in, fd_out)) {
+            exit(FAILED_EXECVP);
+        }
+        CURR_CHILD = 0;
+        exit(eval(stage) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    if (pid > 0) {
+        event_loop_watch(&EVENT_LOOP, pid);
+    }
+    return pid;
 }
 
 void run_fg_cmd(Split_line *line) {
     /// To execute a chain of command(s) in the foreground.
 
     /* Create and execute Syntax Tree. */
-    Expression* ast_root = parse_line(line, 0, line->size - 1);
+    Expression* ast_root = get_ast(line, line->size - 1);
     eval(ast_root);
+}
+
+Expression* get_ast(Split_line* line, int end_index) {
+    /// Returns the Syntax Tree of the words up to `end_index`, taken from the
+    /// AST_CACHE when the same words were already parsed. The tree must not
+    /// be modified: it may be evaluated again by a later line.
+
+    uint64_t start = stats_now();
+    uint64_t hash = ast_cache_hash(line, 0, end_index);
+    Expression* ast = ast_cache_lookup(&AST_CACHE, line, 0, end_index, hash);
+    if (ast != NULL) {
+        hist_since(&SHELL_STATS.parse, start);
+        trace_span("parse (cached)", start / 1e3, NULL, 0);
+        return ast;
+    }
 
-    /* Freeing the memory. */
-    destroy_expression(ast_root);
-    free_split_line(line);
+    ast = parse_line(line, 0, end_index);
+    if (ast != NULL) {  // errors are not cached, so they are reported again
+        ast = ast_cache_insert(&AST_CACHE, line, 0, end_index, hash, ast);
+    }
+    hist_since(&SHELL_STATS.parse, start);
+    trace_span("parse", start / 1e3, NULL, 0);
+    return ast;
 }
 
-int main (void) {
+bool parse_count(const char* str, size_t* count) {
+    /// Reads a non-negative number. Returns false if `str` is not one, or
+    /// if it does not fit in a size_t.
+
+    char* end;
+    errno = 0;
+    unsigned long value = strtoul(str, &end, 10);
+    if (*str < '0' || *str > '9' || *end != 0 || errno == ERANGE
+            || value > SIZE_MAX) {
+        return false;
+    }
+    *count = value;
+    return true;
+}
+
+void parse_options(int argc, char** argv) {
+    /// Reads the command-line options. Exits if one is not recognized.
+
+    const char* spawn = getenv(SPAWN_ENV_VAR);
+    if (spawn != NULL && !set_spawn_mode(spawn)) {
+        fprintf(stderr, "ignoring unknown %s=%s\n", SPAWN_ENV_VAR, spawn);
+    }
+
+    HISTORY_FILE = getenv(HISTORY_ENV_VAR);
+
+    const char* xargs = getenv(XARGS_ENV_VAR);
+    XARGS = xargs != NULL && xargs[0] != 0 && strcmp(xargs, "0") != 0;
+
+    size_t limit;
+    const char* cache = getenv(AST_CACHE_ENV_VAR);
+    if (cache != NULL && parse_count(cache, &limit)) {
+        ast_cache_set_limit(&AST_CACHE, limit);
+    } else if (cache != NULL) {
+        fprintf(stderr, "ignoring invalid %s=%s\n", AST_CACHE_ENV_VAR, cache);
+    }
+
+    const char* script = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--spawn=", 8) == 0 && set_spawn_mode(argv[i]+8)) {
+            continue;
+        }
+        if (strncmp(argv[i], "--ast-cache=", 12) == 0
+                && parse_count(argv[i]+12, &limit)) {
+            ast_cache_set_limit(&AST_CACHE, limit);
+            continue;
+        }
+        if (strncmp(argv[i], "--trace=", 8) == 0 && argv[i][8] != 0) {
+            if (!trace_open(argv[i]+8)) {
+                perror(argv[i]+8);
+                exit(EXIT_FAILURE);
+            }
+            continue;
+        }
+        if (strncmp(argv[i], "--history=", 10) == 0) {
+            HISTORY_FILE = argv[i]+10;  // "" for none
+            continue;
+        }
+        if (strcmp(argv[i], "--xargs") == 0) {
+            XARGS = true;
+            continue;
+        }
+        if (argv[i][0] != '-' && script == NULL) {
+            script = argv[i];
+            continue;
+        }
+        fprintf(stderr, USAGE, argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    /* Script mode: from a file, or from a stdin that is not a terminal. */
+    if (script != NULL) {
+        int fd = open(script, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            perror(script);
+            exit(EXIT_FAILURE);
+        }
+        reader_init(&SCRIPT, fd);
+        INTERACTIVE = false;
+    } else if (!isatty(STDIN_FILENO)) {
+        reader_init(&SCRIPT, STDIN_FILENO);
+        INTERACTIVE = false;
+    }
+}
+
+#ifndef SHELL_NO_MAIN  // the benchmarks include this file and have their own
+int main (int argc, char** argv) {
     /// Instanciates the main shell and queries the command(s).
 
-    fprintf (stdout, "%% ");
+    parse_options(argc, argv);
+    if (SPAWN_MODE == SPAWN_SERVER && !fork_server_start()) {
+        perror("fork server");  // not fatal: the engine falls back
+    }
+    if (INTERACTIVE) {
+        const char* term = getenv("TERM");
+        LINE_EDITING = isatty(STDOUT_FILENO)
+                       && (term == NULL || strcmp(term, "dumb") != 0);
+        if (!history_start(&HISTORY, HISTORY_FILE)) {
+            perror("history");  // the shell works without it
+        }
+    }
+
+    if (INTERACTIVE) {
+        fprintf (stdout, "%% ");
+    }
     /* ¡REMPLIR-ICI! : Lire les commandes de l'utilisateur et les exécuter. */
 
     /* Initial set up. */
     bool running = true;
-    set_up_handlers();
+    set_up_signals();
 
     /* Our shell. */
     while(running) {
 
         /* Ask for an instruction. */
-        char** args = query_and_split_input();
+        report_bg_jobs();
+        Split_line* line = query_and_split_input();
 
-        /* Error handling  |  exit  |  set up. */
-        if (args == NULL) {  // error while reading input
+        /* Error handling  |  executing the command(s). */
+        if (line == NULL) {  // error while reading input
             running = false;
-        } else if (strcmp(args[0], "exit") == 0) {  // home-made "exit" command
-            running = false;
-            debug_free(args);
+        } else if(line->thread_flag) {
+            run_bg_cmd(line);
         } else {
-            int count = count_words(args);
-            Split_line* line = form_split_line(args, count);
-            if(line == NULL) {  // if an error occured: skip and ask new query
-                free_split_line(line);
-                continue;
-            }
-
-            /* Executing the command(s). */
-            if(line->thread_flag) {
-                run_bg_cmd(line);
-            } else {
-                run_fg_cmd(line);
-            }
+            run_fg_cmd(line);
         }
+
+        /* Every object parsed from the line is freed at once. */
+        arena_reset(&LINE_ARENA);
     }
 
+    shell_exit(EXIT_SUCCESS);
+}
+#endif
+
+void shell_exit(int status) {
+    /// Leaves the shell, at the end of the input or through `exit`, after
+    /// giving back what it allocated.
+
+    if (SUBSHELL) {
+        exit(status);  // the parent shell still owns all of it
+    }
+
+    /* A script may end with `build && notify &`: its chains are run to the
+     * end. At a terminal, `exit` does not keep the user waiting for them. */
+    if (!INTERACTIVE) {
+        wait_bg_jobs(false);
+    }
+    detach_bg_jobs();
+    fork_server_stop();
+    event_loop_close(&EVENT_LOOP);
+    history_close(&HISTORY);
+    completion_free();
+    glob_free(&GLOB);
+    vars_free(&VARS);
+    trace_close();
+    ast_cache_set_limit(&AST_CACHE, 0);
+    path_cache_clear(&PATH_CACHE);
+    arena_release(&LINE_ARENA);
+    free(INPUT_LINE);
+    free(SCRIPT.buffer);
+
     /* We're all done here. See you! */
-    printf("Bye!\n");
-    exit (0);
+    if (INTERACTIVE) {
+        printf("Bye!\n");
+    }
+    exit(status);
 }
\ No newline at end of file
@@ -0,0 +1,278 @@
+#ifndef TESTSHELL_PARALLEL_H
+#define TESTSHELL_PARALLEL_H
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+
+#include "line_reader.h"
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define PARALLEL_BUILTIN "parallel"
+#define PARALLEL_ARG "{}"
+#define PARALLEL_MAX_JOBS 1024      // a bigger `-j N` is lowered to it
+#define PARALLEL_USAGE "usage: parallel [-j N] [-a FILE] command [arg...]\n"
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+int   parallel_builtin   (Command* cmd);
+bool  parallel_options   (char** args, int* next, long* jobs,
+                          const char** file);
+pid_t parallel_start     (Command* tmpl, Command* job, char* arg, int fd_in);
+
+
+
+
+/* ********************************************************
+ * BUILTIN
+ * ****************************************************** */
+
+
+/**
+ * `parallel [-j N] [-a FILE] command [arg...]` runs the command once for
+ * every line of FILE (of the standard input by default, which is the rest
+ * of the script when the shell reads one from there), with '{}' in its
+ * arguments replaced by the line, or the line added at the end if there
+ * is no '{}'. At most N commands (one per CPU by default) run at the same
+ * time: a new one starts as soon as the EVENT_LOOP reaps one of them.
+ * After a Ctrl-C, no new one starts. The command is always an external
+ * one, never a builtin.
+ * @return  true if every command succeeded.
+ * */
+int parallel_builtin (Command* cmd){
+    int         next;
+    long        jobs = sysconf(_SC_NPROCESSORS_ONLN);
+    const char* file = NULL;
+
+    if (!parallel_options(cmd->cmd, &next, &jobs, &file)){
+        fprintf(stderr, PARALLEL_USAGE);
+        return false;
+    }
+
+    /* The commands must not eat the lines that are left to read. */
+    int input = STDIN_FILENO;
+    int fd_in = open("/dev/null", O_RDONLY | O_CLOEXEC);
+    if (file != NULL && (input = open(file, O_RDONLY | O_CLOEXEC)) < 0){
+        perror(file);
+        if (fd_in >= 0) close(fd_in);
+        return false;
+    }
+
+    int argc = 0;
+    while (cmd->cmd[next + argc] != NULL) argc++;
+
+    Command         tmpl = {cmd->cmd + next, false, NULL, NULL};
+    Command         job = {malloc((argc + 2) * sizeof(char*)), false, NULL,
+                           NULL};
+    Watched_child*  slots = calloc((size_t) jobs, sizeof(Watched_child));
+    Line_reader     own;
+    Line_reader*    reader = &own;
+    reader_init(&own, input);
+
+    /* A script read from stdin is already buffered in SCRIPT, with the
+     * lines that follow: they are the arguments. */
+    if (file == NULL && !INTERACTIVE && !SUBSHELL
+            && SCRIPT.fd == STDIN_FILENO){
+        reader = &SCRIPT;
+    }
+    if (job.cmd == NULL || slots == NULL){
+        perror("malloc error parallel");
+        free(job.cmd);
+        free(slots);
+        if (fd_in >= 0) close(fd_in);
+        if (input != STDIN_FILENO) close(input);
+        return false;
+    }
+
+    fflush(stdout);
+
+    WATCHED = slots;
+    WATCHED_COUNT = (int) jobs;
+    CURR_CHILD = 0;  // Ctrl-Z has no single child to stop
+
+    int     success = true;
+    int     running = 0;
+    bool    more = true;
+    while (more || running > 0){
+
+        /* Filling the free slots. */
+        for (int i = 0; more && i < jobs; i++){
+            if (slots[i].pid != 0) continue;
+
+            size_t len;
+            char*  line = reader_next_line(reader, &len);
+            while (line != NULL && len == 0){
+                line = reader_next_line(reader, &len);
+            }
+            if (line == NULL){
+                more = false;
+                break;
+            }
+
+            pid_t pid = parallel_start(&tmpl, &job, line, fd_in);
+            if (pid < 0){
+                success = false;
+                continue;
+            }
+            slots[i].pid = pid;
+            slots[i].done = false;
+            running++;
+        }
+
+        if (running == 0){
+            continue;
+        }
+
+        /* Sleeping until the loop reaps a child, then freeing its slot. */
+        int events = event_loop_wait(&EVENT_LOOP, false);
+        if (events > 0 && (events & EVENT_INTERRUPT)){
+            more = false;  // the running ones got the Ctrl-C too
+        }
+        for (int i = 0; i < jobs; i++){
+            if (slots[i].pid == 0 || !slots[i].done) continue;
+            add_usage(&CHILD_USAGE, &slots[i].usage);
+            job.cmd[0] = tmpl.cmd[0];
+            if (!command_status(&job, slots[i].status, false)){
+                success = false;
+            }
+            slots[i].pid = 0;
+            running--;
+        }
+    }
+
+    WATCHED = NULL;
+    WATCHED_COUNT = 0;
+
+    free(own.buffer);
+    free(job.cmd);
+    free(slots);
+    if (fd_in >= 0) close(fd_in);
+    if (input != STDIN_FILENO) close(input);
+    return success;
+}
+
+
+/**
+ * Reads `-j N` (or `-jN`) and `-a FILE`. N is at most PARALLEL_MAX_JOBS.
+ * @param   next    set to the index of the command.
+ * @return  false if an option is wrong or the command is missing.
+ * */
+bool parallel_options (char** args, int* next, long* jobs, const char** file){
+    int i = 1;
+    for (; args[i] != NULL && args[i][0] == '-'; i++){
+        if (strncmp(args[i], "-j", 2) == 0){
+            const char* value = args[i][2] != 0 ? args[i] + 2 : args[++i];
+            char* end;
+            if (value == NULL){
+                return false;
+            }
+            *jobs = strtol(value, &end, 10);
+            if (*end != 0 || end == value || *jobs <= 0){
+                return false;
+            }
+        } else if (strcmp(args[i], "-a") == 0 && args[i + 1] != NULL){
+            *file = args[++i];
+        } else {
+            return false;
+        }
+    }
+
+    if (*jobs <= 0){
+        *jobs = 1;  // unknown number of CPUs
+    }
+    if (*jobs > PARALLEL_MAX_JOBS){
+        *jobs = PARALLEL_MAX_JOBS;
+    }
+    *next = i;
+    return args[i] != NULL;
+}
+
+
+/**
+ * Starts the command of the template for one argument. The words where
+ * every '{}' is replaced are built for the spawn and freed right after it.
+ * @return  the PID of the child, or -1.
+ * */
+pid_t parallel_start (Command* tmpl, Command* job, char* arg, int fd_in){
+    bool replaced = false;
+    int  argc = 0;
+
+    size_t arg_len = strlen(arg);
+    size_t mark_len = strlen(PARALLEL_ARG);
+
+    for (; tmpl->cmd[argc] != NULL; argc++){
+        char*  word = tmpl->cmd[argc];
+        size_t count = 0;
+        for (char* found = strstr(word, PARALLEL_ARG); found != NULL;
+             found = strstr(found + mark_len, PARALLEL_ARG)){
+            count++;
+        }
+        job->cmd[argc] = word;
+        if (count == 0){
+            continue;
+        }
+        replaced = true;
+        if (strcmp(word, PARALLEL_ARG) == 0){
+            job->cmd[argc] = arg;
+            continue;
+        }
+
+        char* copy = malloc(strlen(word) - count * mark_len
+                            + count * arg_len + 1);
+        if (copy == NULL){
+            job->cmd[argc] = NULL;
+            argc = -1;
+            break;
+        }
+        char* out = copy;
+        for (char* found; (found = strstr(word, PARALLEL_ARG)) != NULL;
+             word = found + mark_len){
+            memcpy(out, word, (size_t) (found - word));
+            out += found - word;
+            memcpy(out, arg, arg_len);
+            out += arg_len;
+        }
+        strcpy(out, word);
+        job->cmd[argc] = copy;
+    }
+
+    pid_t pid = -1;
+    if (argc >= 0){
+        if (!replaced){
+            job->cmd[argc++] = arg;
+        }
+        job->cmd[argc] = NULL;
+
+        bool cached;
+        pid = start_command(job, fd_in, -1, &cached);
+    } else {
+        perror("malloc error parallel");
+    }
+
+    for (int i = 0; job->cmd[i] != NULL; i++){
+        if (job->cmd[i] != tmpl->cmd[i] && job->cmd[i] != arg){
+            free(job->cmd[i]);
+        }
+    }
+    return pid;
+}
+
+
+#endif //TESTSHELL_PARALLEL_H
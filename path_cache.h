@@ -0,0 +1,381 @@
+#ifndef TESTSHELL_PATH_CACHE_H
+#define TESTSHELL_PATH_CACHE_H
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <limits.h>
+#include <sys/stat.h>
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define HASH_BUILTIN "hash"
+#define PATH_CACHE_MIN_BUCKETS 64
+#ifndef FNV_OFFSET
+#define FNV_OFFSET 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+#endif
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * A command name and the file `execvp()` would have found for it. Both
+ * strings are stored right after the struct, in the same allocation.
+ * */
+typedef struct Path_entry {
+    char*                   name;
+    char*                   path;
+    unsigned long           hits;       // times the entry was used
+    struct Path_entry*      next;       // same bucket
+} Path_entry;
+
+
+/**
+ * Hash table of the commands resolved through $PATH. It is emptied
+ * whenever $PATH changes.
+ * */
+typedef struct Path_cache {
+    Path_entry**    buckets;
+    size_t          bucket_count;   // power of two, or 0
+    size_t          size;
+    char*           path_var;       // $PATH when the table was filled
+    uint64_t        path_changed;   // when it was set, in VARS.changes
+} Path_cache;
+
+
+Path_cache PATH_CACHE = {NULL, 0, 0, NULL, 0};
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+const char* path_cache_lookup   (Path_cache* cache, const char* name,
+                                 bool* cached);
+void        path_cache_forget   (Path_cache* cache, const char* name);
+void        path_cache_clear    (Path_cache* cache);
+void        path_cache_check_var(Path_cache* cache);
+void        path_cache_changed_dir(Path_cache* cache);
+Path_entry* path_cache_add      (Path_cache* cache, const char* name,
+                                 const char* path);
+bool        search_path         (const char* name, char* found, size_t size);
+uint64_t    hash_string         (const char* str);
+int         hash_builtin        (Command* cmd);
+
+
+
+
+/* ********************************************************
+ * CACHE FUNCTIONS
+ * ****************************************************** */
+
+
+/**
+ * FNV-1a hash of a string.
+ * */
+uint64_t hash_string (const char* str){
+    uint64_t hash = FNV_OFFSET;
+    for (; *str != 0; str++){
+        hash = (hash ^ (unsigned char) *str) * FNV_PRIME;
+    }
+    return hash;
+}
+
+
+/**
+ * Finds the file to execute for a command. Names containing a '/' are
+ * used as they are. Other names are looked up in the cache first, and
+ * then in every directory of $PATH.
+ * @param   cached  set to true if the answer came from the cache, in which
+ *                  case the file may have disappeared since.
+ * @return  the path of the file, or NULL if the command does not exist.
+ * */
+const char* path_cache_lookup (Path_cache* cache, const char* name,
+                               bool* cached){
+    *cached = false;
+    if (strchr(name, '/') != NULL){
+        return name;
+    }
+
+    path_cache_check_var(cache);
+
+    if (cache->bucket_count != 0){
+        Path_entry* entry = cache->buckets[hash_string(name)
+                                           & (cache->bucket_count - 1)];
+        while (entry != NULL && strcmp(entry->name, name) != 0){
+            entry = entry->next;
+        }
+        if (entry != NULL){
+            entry->hits++;
+            *cached = true;
+            return entry->path;
+        }
+    }
+
+    char found[PATH_MAX];
+    if (!search_path(name, found, sizeof(found))){
+        return NULL;
+    }
+
+    Path_entry* entry = path_cache_add(cache, name, found);
+    if (entry == NULL){
+        return NULL;  // OOM
+    }
+    entry->hits++;
+    return entry->path;
+}
+
+
+/**
+ * Empties the table if $PATH is not what it was when it was filled. The
+ * value is only compared when the variable was set again since.
+ * */
+void path_cache_check_var (Path_cache* cache){
+    Var*     var = var_find(&VARS, "PATH", 4);
+    uint64_t changed = var != NULL ? var->changed : 0;
+    if (cache->path_var != NULL && cache->path_changed == changed){
+        return;
+    }
+
+    const char* path_var = var != NULL ? var->entry + var->name_len + 1 : "";
+    if (cache->path_var == NULL || strcmp(cache->path_var, path_var) != 0){
+        path_cache_clear(cache);
+        cache->path_var = strdup(path_var);
+    }
+    cache->path_changed = changed;
+}
+
+
+/**
+ * Empties the table after a change of directory if $PATH has a relative
+ * directory: what was found through it is not valid from elsewhere.
+ * */
+void path_cache_changed_dir (Path_cache* cache){
+    const char* dir = cache->path_var;
+    if (dir == NULL){
+        return;
+    }
+
+    while (true){
+        if (*dir != '/'){  // relative, or empty (the current directory)
+            path_cache_clear(cache);
+            return;
+        }
+        dir = strchr(dir, ':');
+        if (dir == NULL){
+            return;
+        }
+        dir++;
+    }
+}
+
+
+/**
+ * Adds (or replaces) the path of a command.
+ * @return  the new entry, or NULL when out of memory.
+ * */
+Path_entry* path_cache_add (Path_cache* cache, const char* name,
+                            const char* path){
+    path_cache_forget(cache, name);
+
+    if (cache->size >= cache->bucket_count){
+        size_t count = cache->bucket_count ? cache->bucket_count * 2
+                                           : PATH_CACHE_MIN_BUCKETS;
+        Path_entry** buckets = calloc(count, sizeof(Path_entry*));
+        if (buckets == NULL){
+            return NULL;  // OOM
+        }
+        for (size_t b = 0; b < cache->bucket_count; b++){
+            Path_entry* entry = cache->buckets[b];
+            while (entry != NULL){
+                Path_entry* next = entry->next;
+                size_t slot = hash_string(entry->name) & (count - 1);
+                entry->next = buckets[slot];
+                buckets[slot] = entry;
+                entry = next;
+            }
+        }
+        free(cache->buckets);
+        cache->buckets = buckets;
+        cache->bucket_count = count;
+    }
+
+    size_t name_len = strlen(name) + 1;
+    size_t path_len = strlen(path) + 1;
+    Path_entry* entry = malloc(sizeof(Path_entry) + name_len + path_len);
+    if (entry == NULL){
+        return NULL;  // OOM
+    }
+    entry->name = (char*) (entry + 1);
+    entry->path = entry->name + name_len;
+    memcpy(entry->name, name, name_len);
+    memcpy(entry->path, path, path_len);
+    entry->hits = 0;
+
+    size_t slot = hash_string(name) & (cache->bucket_count - 1);
+    entry->next = cache->buckets[slot];
+    cache->buckets[slot] = entry;
+    cache->size++;
+    return entry;
+}
+
+
+/**
+ * Removes a command from the table, e.g. when its file is gone.
+ * */
+void path_cache_forget (Path_cache* cache, const char* name){
+    if (cache->bucket_count == 0){
+        return;
+    }
+
+    Path_entry** link = &cache->buckets[hash_string(name)
+                                        & (cache->bucket_count - 1)];
+    while (*link != NULL){
+        if (strcmp((*link)->name, name) == 0){
+            Path_entry* entry = *link;
+            *link = entry->next;
+            free(entry);
+            cache->size--;
+            return;
+        }
+        link = &(*link)->next;
+    }
+}
+
+
+/**
+ * Removes every command from the table.
+ * */
+void path_cache_clear (Path_cache* cache){
+    for (size_t b = 0; b < cache->bucket_count; b++){
+        Path_entry* entry = cache->buckets[b];
+        while (entry != NULL){
+            Path_entry* next = entry->next;
+            free(entry);
+            entry = next;
+        }
+    }
+    free(cache->buckets);
+    free(cache->path_var);
+    cache->buckets = NULL;
+    cache->bucket_count = 0;
+    cache->size = 0;
+    cache->path_var = NULL;
+}
+
+
+/**
+ * Looks for an executable file called `name` in the directories of $PATH,
+ * in order. An empty directory stands for the current one. Without $PATH,
+ * the default of the system is used, like `execvp()` does.
+ * @return  false if there is none, or it does not fit in `found`.
+ * */
+bool search_path (const char* name, char* found, size_t size){
+    static char default_path[PATH_MAX];
+    const char* dir = var_get(&VARS, "PATH");
+    if (dir == NULL){
+        size_t len = confstr(_CS_PATH, default_path, sizeof(default_path));
+        if (len == 0 || len > sizeof(default_path)){
+            return false;
+        }
+        dir = default_path;
+    }
+
+    while (true){
+        const char* dir_end = strchr(dir, ':');
+        if (dir_end == NULL){
+            dir_end = dir + strlen(dir);
+        }
+        int dir_len = (int) (dir_end - dir);
+        int len = (dir_len == 0) ? snprintf(found, size, "%s", name)
+                                 : snprintf(found, size, "%.*s/%s",
+                                            dir_len, dir, name);
+
+        struct stat info;
+        if (len > 0 && (size_t) len < size && stat(found, &info) == 0
+                && S_ISREG(info.st_mode) && access(found, X_OK) == 0){
+            return true;
+        }
+
+        if (*dir_end == 0){
+            return false;
+        }
+        dir = dir_end + 1;
+    }
+}
+
+
+
+
+/* ********************************************************
+ * BUILTIN
+ * ****************************************************** */
+
+
+/**
+ * `hash`           lists the cached commands, with their number of uses.
+ * `hash -r`        empties the cache.
+ * `hash name...`   looks the commands up and adds them to the cache.
+ * @return  false if one of the names could not be found.
+ * */
+int hash_builtin (Command* cmd){
+    char** args = cmd->cmd;
+
+    if (args[1] == NULL){
+        path_cache_check_var(&PATH_CACHE);
+        if (PATH_CACHE.size == 0){
+            printf("hash: hash table empty\n");
+        } else {
+            printf("hits\tcommand\n");
+        }
+        for (size_t b = 0; b < PATH_CACHE.bucket_count; b++){
+            Path_entry* entry = PATH_CACHE.buckets[b];
+            for (; entry != NULL; entry = entry->next){
+                printf("%4lu\t%s\n", entry->hits, entry->path);
+            }
+        }
+        return true;
+    }
+
+    if (strcmp(args[1], "-r") == 0 && args[2] == NULL){
+        path_cache_clear(&PATH_CACHE);
+        return true;
+    }
+
+    path_cache_check_var(&PATH_CACHE);
+
+    int success = true;
+    for (int i = 1; args[i] != NULL; i++){
+        char found[PATH_MAX];
+        if (strchr(args[i], '/') != NULL){
+            continue;  // never looked up in $PATH
+        }
+        if (!search_path(args[i], found, sizeof(found))){
+            fprintf(stderr, "hash: %s: not found\n", args[i]);
+            success = false;
+        } else {
+            path_cache_add(&PATH_CACHE, args[i], found);
+        }
+    }
+    return success;
+}
+
+
+#endif //TESTSHELL_PATH_CACHE_H
@@ -0,0 +1,275 @@
+#ifndef TESTSHELL_SHELL_STATS_H
+#define TESTSHELL_SHELL_STATS_H
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define SHELLSTAT_BUILTIN "shellstat"
+#define SHELLSTAT_USAGE "usage: shellstat [-j] [-r]\n"
+
+#define HIST_SUB_BITS 4                 // 16 buckets per power of two,
+#define HIST_SUB (1 << HIST_SUB_BITS)   // so values are within 6.25%
+#define HIST_BUCKETS ((64 - HIST_SUB_BITS + 1) * HIST_SUB)
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * Log-linear histogram of durations in nanoseconds, in the manner of HDR
+ * histograms: every power of two is cut into HIST_SUB equal buckets, so
+ * recording is a couple of shifts and the relative error is bounded
+ * whatever the magnitude.
+ * */
+typedef struct Histogram {
+    uint64_t        counts[HIST_BUCKETS];
+    uint64_t        count;
+    uint64_t        sum;
+    uint64_t        min;
+    uint64_t        max;
+} Histogram;
+
+
+/**
+ * Counters of the shell, always on. Reset by `shellstat -r`.
+ * */
+typedef struct Shell_stats {
+    unsigned long           lines_read;
+    unsigned long           commands_spawned;
+    unsigned long           fork_failures;      // no child at all
+    unsigned long           exec_failures;      // FAILED_EXECVP
+    unsigned long           bg_started;
+    unsigned long           bg_reaped;          // finished and reported
+    unsigned long           parser_bytes_base;  // LINE_ARENA.bytes at reset
+    Histogram               parse;              // `get_ast()`
+    Histogram               spawn;              // lookup + spawn engine
+    Histogram               command;            // spawn to exit
+} Shell_stats;
+
+
+Shell_stats SHELL_STATS;
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+uint64_t stats_now           ();
+void     stats_reset         ();
+void     hist_record         (Histogram* hist, uint64_t value);
+void     hist_since          (Histogram* hist, uint64_t start);
+uint64_t hist_percentile     (const Histogram* hist, double percent);
+size_t   hist_bucket         (uint64_t value);
+uint64_t hist_bucket_top     (size_t bucket);
+void     print_hist_text     (const char* name, const Histogram* hist);
+void     print_hist_json     (const char* name, const Histogram* hist,
+                              bool last);
+int      shellstat_builtin   (Command* cmd);
+
+
+
+
+/* ********************************************************
+ * HISTOGRAM FUNCTIONS
+ * ****************************************************** */
+
+
+/**
+ * @return  the CLOCK_MONOTONIC time in nanoseconds.
+ * */
+uint64_t stats_now (){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+
+/**
+ * Index of the bucket of a value: the values below HIST_SUB have one
+ * bucket each, then every power of two gets HIST_SUB buckets.
+ * */
+size_t hist_bucket (uint64_t value){
+    if (value < HIST_SUB){
+        return (size_t) value;
+    }
+    int msb = 63 - __builtin_clzll(value);
+    int shift = msb - HIST_SUB_BITS;
+    return (size_t) (shift + 1) * HIST_SUB
+         + (size_t) ((value >> shift) - HIST_SUB);
+}
+
+
+/**
+ * @return  the highest value that falls in a bucket.
+ * */
+uint64_t hist_bucket_top (size_t bucket){
+    if (bucket < HIST_SUB){
+        return bucket;
+    }
+    int shift = (int) (bucket / HIST_SUB) - 1;
+    uint64_t low = (uint64_t) (bucket % HIST_SUB + HIST_SUB) << shift;
+    return low + (((uint64_t) 1 << shift) - 1);
+}
+
+
+void hist_record (Histogram* hist, uint64_t value){
+    hist->counts[hist_bucket(value)]++;
+    if (hist->count == 0 || value < hist->min) hist->min = value;
+    if (value > hist->max)                     hist->max = value;
+    hist->count++;
+    hist->sum += value;
+}
+
+
+/**
+ * Records the time elapsed since `start`, a value of `stats_now()`.
+ * */
+void hist_since (Histogram* hist, uint64_t start){
+    hist_record(hist, stats_now() - start);
+}
+
+
+/**
+ * @return  a value that at least `percent` % of the recorded values do not
+ *          exceed (within the precision of the buckets), or 0 if empty.
+ * */
+uint64_t hist_percentile (const Histogram* hist, double percent){
+    if (hist->count == 0){
+        return 0;
+    }
+    // the smallest rank with `percent` % of the values at or below it
+    uint64_t rank = (uint64_t) ceil(percent * (double) hist->count / 100.0);
+    if (rank == 0) rank = 1;
+
+    uint64_t seen = 0;
+    for (size_t b = 0; b < HIST_BUCKETS; b++){
+        seen += hist->counts[b];
+        if (seen >= rank){
+            uint64_t top = hist_bucket_top(b);
+            return top < hist->max ? top : hist->max;
+        }
+    }
+    return hist->max;
+}
+
+
+/**
+ * Forgets everything recorded so far, including the AST cache hits.
+ * */
+void stats_reset (){
+    memset(&SHELL_STATS, 0, sizeof(SHELL_STATS));
+    SHELL_STATS.parser_bytes_base = LINE_ARENA.bytes;
+    AST_CACHE.hits = 0;
+    AST_CACHE.misses = 0;
+    AST_CACHE.evictions = 0;
+}
+
+
+
+
+/* ********************************************************
+ * BUILTIN
+ * ****************************************************** */
+
+
+void print_hist_text (const char* name, const Histogram* hist){
+    printf("%-10s %8llu %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", name,
+           (unsigned long long) hist->count, hist->min / 1e3,
+           hist_percentile(hist, 50) / 1e3, hist_percentile(hist, 90) / 1e3,
+           hist_percentile(hist, 99) / 1e3, hist_percentile(hist, 99.9) / 1e3,
+           hist->max / 1e3);
+}
+
+
+void print_hist_json (const char* name, const Histogram* hist, bool last){
+    printf("\"%s\":{\"count\":%llu,\"sum\":%llu,\"min\":%llu,\"p50\":%llu,"
+           "\"p90\":%llu,\"p99\":%llu,\"p999\":%llu,\"max\":%llu}%s",
+           name, (unsigned long long) hist->count,
+           (unsigned long long) hist->sum, (unsigned long long) hist->min,
+           (unsigned long long) hist_percentile(hist, 50),
+           (unsigned long long) hist_percentile(hist, 90),
+           (unsigned long long) hist_percentile(hist, 99),
+           (unsigned long long) hist_percentile(hist, 99.9),
+           (unsigned long long) hist->max, last ? "" : ",");
+}
+
+
+/**
+ * `shellstat`      prints the counters and the latency histograms.
+ * `shellstat -j`   prints them as a single line of JSON (durations in ns).
+ * `shellstat -r`   resets them once printed.
+ * */
+int shellstat_builtin (Command* cmd){
+    bool json = false;
+    bool reset = false;
+    for (int i = 1; cmd->cmd[i] != NULL; i++){
+        if (strcmp(cmd->cmd[i], "-j") == 0){
+            json = true;
+        } else if (strcmp(cmd->cmd[i], "-r") == 0){
+            reset = true;
+        } else {
+            fprintf(stderr, SHELLSTAT_USAGE);
+            return false;
+        }
+    }
+
+    Shell_stats* s = &SHELL_STATS;
+    unsigned long parser_bytes = LINE_ARENA.bytes - s->parser_bytes_base;
+
+    if (json){
+        printf("{\"lines_read\":%lu,\"commands_spawned\":%lu,"
+               "\"fork_failures\":%lu,\"exec_failures\":%lu,"
+               "\"bg_started\":%lu,\"bg_reaped\":%lu,\"parser_bytes\":%lu,"
+               "\"ast_cache_hits\":%lu,\"ast_cache_misses\":%lu,",
+               s->lines_read, s->commands_spawned, s->fork_failures,
+               s->exec_failures, s->bg_started, s->bg_reaped, parser_bytes,
+               AST_CACHE.hits, AST_CACHE.misses);
+        print_hist_json("parse_ns", &s->parse, false);
+        print_hist_json("spawn_ns", &s->spawn, false);
+        print_hist_json("command_ns", &s->command, true);
+        printf("}\n");
+    } else {
+        printf("lines read          %lu\n"
+               "commands spawned    %lu\n"
+               "fork failures       %lu\n"
+               "exec failures       %lu\n"
+               "background jobs     %lu started, %lu reaped\n"
+               "parser bytes        %lu\n"
+               "ast cache           %lu hits, %lu misses\n\n",
+               s->lines_read, s->commands_spawned, s->fork_failures,
+               s->exec_failures, s->bg_started, s->bg_reaped, parser_bytes,
+               AST_CACHE.hits, AST_CACHE.misses);
+        printf("%-10s %8s %10s %10s %10s %10s %10s %10s\n", "us", "count",
+               "min", "p50", "p90", "p99", "p99.9", "max");
+        print_hist_text("parse", &s->parse);
+        print_hist_text("spawn", &s->spawn);
+        print_hist_text("command", &s->command);
+    }
+
+    if (reset){
+        stats_reset();
+    }
+    return true;
+}
+
+
+#endif //TESTSHELL_SHELL_STATS_H
@@ -0,0 +1,329 @@
+#ifndef TESTSHELL_SPAWN_ENGINE_H
+#define TESTSHELL_SPAWN_ENGINE_H
+
+
+#include <spawn.h>
+#include <paths.h>
+
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define SPAWN_ENV_VAR "SHELL_SPAWN"
+#define REDIRECT_FLAGS (O_WRONLY | O_CREAT)
+#define REDIRECT_MODE (S_IRWXU | S_IRWXG | S_IRWXO)
+
+static const char * spawnModeStrings[] = {"fork", "vfork", "posix_spawn",
+                                          "server"};
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * The different ways a child process can be created. SPAWN_FORK is the
+ * original full `fork()` of the shell, kept around so the per-command
+ * latency of the other engines can be compared against it. SPAWN_SERVER
+ * asks the fork server of "fork_server.h".
+ * */
+typedef enum {SPAWN_FORK, SPAWN_VFORK, SPAWN_POSIX, SPAWN_SERVER} spawn_mode;
+
+
+/**
+ * Engine used by `spawn_command()`. Selected at start-up through the
+ * `--spawn=` option or the SHELL_SPAWN environment variable.
+ * */
+spawn_mode SPAWN_MODE = SPAWN_POSIX;
+
+
+/**
+ * Error of the last exec that failed in a way the shell could see (always
+ * with posix_spawn, vfork and the fork server, never with fork).
+ * */
+volatile int SPAWN_ERROR = 0;
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+bool  set_spawn_mode        (const char* name);
+pid_t spawn_command         (Command* cmd, const char* path,
+                             char** envp, int fd_in, int fd_out);
+pid_t spawn_with_fork       (Command* cmd, const char* path,
+                             char** envp, int fd_in, int fd_out);
+pid_t spawn_with_vfork      (Command* cmd, const char* path,
+                             char** envp, int fd_in, int fd_out);
+pid_t spawn_with_posix      (Command* cmd, const char* path,
+                             char** envp, int fd_in, int fd_out);
+pid_t spawn_with_server     (Command* cmd, const char* path,
+                             char** envp, int fd_in, int fd_out);
+bool  plug_std_fds          (int fd_in, int fd_out);
+char** script_words         (Command* cmd, const char* path);
+
+
+
+
+/* ********************************************************
+ * SPAWN FUNCTIONS
+ * ****************************************************** */
+
+
+/**
+ * Selects the engine used to create the children.
+ * @param   name    one of the `spawnModeStrings`.
+ * @return  false if the name does not match any engine.
+ * */
+bool set_spawn_mode (const char* name){
+    for (int i = 0; i <= SPAWN_SERVER; i++){
+        if (strcmp(name, spawnModeStrings[i]) == 0){
+            SPAWN_MODE = (spawn_mode) i;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * Starts the process described by a command, without waiting for it.
+ * `path` is the file to execute, already resolved by the caller: no
+ * engine walks $PATH. `fd_in` and `fd_out` become the standard input and
+ * output of the child (-1 keeps the ones of the shell); a '>' still
+ * wins over `fd_out`.
+ * The child ignores Ctrl-Z, starts with no blocked signal (the shell
+ * keeps the ones of its EVENT_LOOP blocked) and has its output redirected
+ * if the command contains a '>'. A file the kernel cannot execute is run
+ * by /bin/sh instead, as `execvp()` does. A child whose redirection or
+ * exec fails exits with FAILED_EXECVP, whatever engine created it.
+ * @return  the PID of the child, or -1 if no child could be started
+ *          (which the caller must treat like a FAILED_EXECVP status).
+ *          SPAWN_ERROR is then set when the exec itself failed.
+ * */
+pid_t spawn_command (Command* cmd, const char* path, char** envp,
+                     int fd_in, int fd_out){
+    pid_t pid;
+    SPAWN_ERROR = 0;
+    switch (SPAWN_MODE){
+        case SPAWN_FORK:
+            pid = spawn_with_fork(cmd, path, envp, fd_in, fd_out);
+            break;
+        case SPAWN_VFORK:
+            pid = spawn_with_vfork(cmd, path, envp, fd_in, fd_out);
+            break;
+        case SPAWN_POSIX:
+            pid = spawn_with_posix(cmd, path, envp, fd_in, fd_out);
+            break;
+        case SPAWN_SERVER:
+            pid = spawn_with_server(cmd, path, envp, fd_in, fd_out);
+            break;
+        default:
+            return -1;
+    }
+
+    /* A file without "#!" is a script for sh, as `execvp()` would say. */
+    char** words = pid < 0 && SPAWN_ERROR == ENOEXEC
+                   && strcmp(path, _PATH_BSHELL) != 0
+                 ? script_words(cmd, path) : NULL;
+    if (words != NULL){
+        Command script = *cmd;
+        script.cmd = words;
+        return spawn_command(&script, _PATH_BSHELL, envp, fd_in, fd_out);
+    }
+    return pid;
+}
+
+
+/**
+ * Called by a child to take `fd_in` and `fd_out` as its standard input
+ * and output. Async-signal-safe.
+ * */
+bool plug_std_fds (int fd_in, int fd_out){
+    if (fd_in >= 0 && fd_in != STDIN_FILENO
+            && dup2(fd_in, STDIN_FILENO) < 0){
+        return false;
+    }
+    if (fd_out >= 0 && fd_out != STDOUT_FILENO
+            && dup2(fd_out, STDOUT_FILENO) < 0){
+        return false;
+    }
+    return true;
+}
+
+
+/**
+ * Legacy engine: duplicates the whole address space of the shell. The
+ * exec can only fail in the child, which handles ENOEXEC and reports the
+ * error itself.
+ * */
+pid_t spawn_with_fork (Command* cmd, const char* path, char** envp,
+                       int fd_in, int fd_out){
+    pid_t pid = fork();
+
+    if (pid == 0){  // child
+        remove_Z_handler();  // prevent Cltr-Z triggers in child
+
+        sigset_t none;
+        sigemptyset(&none);
+        sigprocmask(SIG_SETMASK, &none, NULL);
+
+        if (!plug_std_fds(fd_in, fd_out) || (cmd->redirect_flag
+                    && !writeOutputInFile(cmd->output_file))){
+            exit(FAILED_EXECVP);
+        }
+
+        execve(path, cmd->cmd, envp);
+        char** words = errno == ENOEXEC ? script_words(cmd, path) : NULL;
+        if (words != NULL){
+            execve(_PATH_BSHELL, words, envp);
+        }
+        fprintf(stderr, "%s: %s\n", cmd->cmd[0], strerror(errno));
+        exit(FAILED_EXECVP);
+    }
+
+    return pid;
+}
+
+
+/**
+ * Borrows the address space of the shell until the child calls exec, so
+ * its cost does not grow with the size of the shell. Every signal is
+ * blocked around the `vfork()` so that none can act on the child before
+ * it has set its dispositions.
+ * Sharing the memory also lets the child report why its exec failed.
+ * */
+pid_t spawn_with_vfork (Command* cmd, const char* path, char** envp,
+                        int fd_in, int fd_out){
+    sigset_t all, old;
+    sigfillset(&all);
+    sigprocmask(SIG_SETMASK, &all, &old);
+
+    pid_t pid = vfork();
+
+    if (pid == 0){  // child: only async-signal-safe calls from here on
+        struct sigaction ign;
+        ign.sa_handler = SIG_IGN;  // prevent Cltr-Z triggers in child
+        sigemptyset(&ign.sa_mask);
+        ign.sa_flags = 0;
+        sigaction(SIGTSTP, &ign, NULL);
+
+        sigemptyset(&all);
+        sigprocmask(SIG_SETMASK, &all, NULL);
+
+        if (!plug_std_fds(fd_in, fd_out) || (cmd->redirect_flag
+                    && !writeOutputInFile(cmd->output_file))){
+            _exit(FAILED_EXECVP);
+        }
+
+        execve(path, cmd->cmd, envp);
+        SPAWN_ERROR = errno;
+        _exit(FAILED_EXECVP);
+    }
+
+    sigprocmask(SIG_SETMASK, &old, NULL);
+
+    if (pid > 0 && SPAWN_ERROR != 0){
+        waitpid(pid, NULL, 0);  // nothing left to wait for
+        return -1;
+    }
+    return pid;
+}
+
+
+/**
+ * Lets the C library pick the cheapest way to create the child
+ * (`clone(CLONE_VM|CLONE_VFORK)` on glibc). The pipes and the redirection
+ * are expressed as file actions. Ctrl-Z cannot be ignored through the
+ * spawn attributes, but the default action of SIGTSTP stops the child just
+ * like the SIGSTOP sent by the shell on Ctrl-Z, so the shell sees the same
+ * thing.
+ * */
+pid_t spawn_with_posix (Command* cmd, const char* path, char** envp,
+                        int fd_in, int fd_out){
+    posix_spawn_file_actions_t  actions;
+    posix_spawn_file_actions_t* actions_ptr = NULL;
+    posix_spawnattr_t           attr;
+    sigset_t                    none;
+
+    if (cmd->redirect_flag || fd_in >= 0 || fd_out >= 0){
+        if (posix_spawn_file_actions_init(&actions) != 0){
+            return -1;
+        }
+        actions_ptr = &actions;
+
+        int error = 0;
+        if (fd_in >= 0 && fd_in != STDIN_FILENO){
+            error |= posix_spawn_file_actions_adddup2(&actions, fd_in,
+                                                      STDIN_FILENO);
+        }
+        if (fd_out >= 0 && fd_out != STDOUT_FILENO){
+            error |= posix_spawn_file_actions_adddup2(&actions, fd_out,
+                                                      STDOUT_FILENO);
+        }
+        if (cmd->redirect_flag){
+            error |= posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO,
+                        cmd->output_file, REDIRECT_FLAGS, REDIRECT_MODE);
+        }
+        if (error != 0){
+            posix_spawn_file_actions_destroy(&actions);
+            return -1;
+        }
+    }
+
+    sigemptyset(&none);
+    posix_spawnattr_init(&attr);
+    posix_spawnattr_setsigmask(&attr, &none);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK);
+
+    pid_t pid;
+    int error = posix_spawn(&pid, path, actions_ptr, &attr, cmd->cmd, envp);
+
+    posix_spawnattr_destroy(&attr);
+    if (actions_ptr != NULL){
+        posix_spawn_file_actions_destroy(actions_ptr);
+    }
+
+    // the library already reaped the child when the redirection or the
+    // exec failed: there is no status left to wait for
+    if (error != 0){
+        SPAWN_ERROR = error;
+        return -1;
+    }
+    return pid;
+}
+
+
+/**
+ * The words that run the file `path` as a shell script, like `execvp()`
+ * does when the kernel does not know its format: "/bin/sh", the path,
+ * then the arguments of the command. They are in the LINE_ARENA.
+ * @return  NULL if memory is lacking.
+ * */
+char** script_words (Command* cmd, const char* path){
+    int argc = 0;
+    while (cmd->cmd[argc] != NULL) argc++;
+
+    char** words = arena_alloc(&LINE_ARENA, (argc + 2) * sizeof(char*));
+    if (words == NULL){
+        return NULL;
+    }
+    words[0] = _PATH_BSHELL;
+    words[1] = (char*) path;
+    memcpy(words + 2, cmd->cmd + 1, argc * sizeof(char*));  // and the NULL
+    return words;
+}
+
+
+#endif //TESTSHELL_SPAWN_ENGINE_H
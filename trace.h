@@ -0,0 +1,187 @@
+#ifndef TESTSHELL_TRACE_H
+#define TESTSHELL_TRACE_H
+
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define TRACE_FLAGS (O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC)
+#define TRACE_MODE 0644
+#define TRACE_EVENT_MAX 1024
+#define TRACE_DETAIL_MAX 256
+
+
+/**
+ * File of the `--trace=` option, or -1 when nothing is traced. Every event
+ * is a single `write()` on an O_APPEND file, so the background copies of
+ * the shell can add theirs to the same file without mixing them up.
+ * */
+int   TRACE_FD = -1;
+pid_t TRACE_PID = 0;    // the shell: one process in the trace viewer
+pid_t TRACE_TID = 0;    // the track of this copy of the shell
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+bool   trace_open       (const char* path);
+void   trace_close      ();
+void   trace_track      (const char* name);
+double trace_start      ();
+void   trace_span       (const char* name, double start, char** words,
+                         pid_t child);
+size_t trace_escape     (char* out, size_t size, char** words);
+
+
+
+
+/* ********************************************************
+ * TRACE FUNCTIONS
+ * ****************************************************** */
+
+
+/**
+ * Starts a trace in the Chrome trace-event format (a JSON array of events,
+ * which the viewers accept without its closing ']'), readable by
+ * chrome://tracing and Perfetto.
+ * @return  false if the file cannot be created.
+ * */
+bool trace_open (const char* path){
+    TRACE_FD = open(path, TRACE_FLAGS, TRACE_MODE);
+    if (TRACE_FD < 0){
+        return false;
+    }
+    TRACE_PID = getpid();
+    TRACE_TID = TRACE_PID;
+
+    char event[TRACE_EVENT_MAX];
+    int len = snprintf(event, sizeof(event),
+                       "[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+                       "\"args\":{\"name\":\"shell_fork\"}},\n",
+                       (int) TRACE_PID);
+    if (write(TRACE_FD, event, (size_t) len) < 0){
+        trace_close();
+        return false;
+    }
+    trace_track("shell");
+    return true;
+}
+
+
+void trace_close (){
+    if (TRACE_FD >= 0){
+        close(TRACE_FD);
+        TRACE_FD = -1;
+    }
+}
+
+
+/**
+ * Puts the next events of this process on a track of its own, called
+ * `name`. Called by the forked copies of the shell.
+ * */
+void trace_track (const char* name){
+    if (TRACE_FD < 0){
+        return;
+    }
+    TRACE_TID = getpid();
+
+    char event[TRACE_EVENT_MAX];
+    int len = snprintf(event, sizeof(event),
+                       "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+                       "\"tid\":%d,\"args\":{\"name\":\"%s %d\"}},\n",
+                       (int) TRACE_PID, (int) TRACE_TID, name,
+                       (int) TRACE_TID);
+    if (write(TRACE_FD, event, (size_t) len) < 0){
+        trace_close();
+    }
+}
+
+
+/**
+ * @return  the CLOCK_MONOTONIC time in microseconds, or 0 when nothing is
+ *          traced (so the clock is not even read).
+ * */
+double trace_start (){
+    if (TRACE_FD < 0){
+        return 0;
+    }
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec * 1e6 + (double) ts.tv_nsec / 1e3;
+}
+
+
+/**
+ * Writes a complete event ("ph":"X") from `start` to now.
+ * @param   words   shown as the detail of the span (a command and its
+ *                  arguments), or NULL.
+ * @param   child   the PID of the child the span is about, or 0.
+ * */
+void trace_span (const char* name, double start, char** words, pid_t child){
+    if (TRACE_FD < 0){
+        return;
+    }
+    double end = trace_start();
+
+    char detail[TRACE_DETAIL_MAX];
+    trace_escape(detail, sizeof(detail), words);
+
+    char event[TRACE_EVENT_MAX];
+    int len = snprintf(event, sizeof(event),
+                       "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+                       "\"dur\":%.3f,\"pid\":%d,\"tid\":%d,"
+                       "\"args\":{\"detail\":\"%s\",\"child\":%d}},\n",
+                       name, start, end - start, (int) TRACE_PID,
+                       (int) TRACE_TID, detail, (int) child);
+    if (len > 0 && (size_t) len < sizeof(event)
+            && write(TRACE_FD, event, (size_t) len) < 0){
+        trace_close();
+    }
+}
+
+
+/**
+ * Joins `words` with spaces in `out`, escaped for a JSON string and cut
+ * if it does not fit.
+ * @return  the length written.
+ * */
+size_t trace_escape (char* out, size_t size, char** words){
+    size_t len = 0;
+    for (int w = 0; words != NULL && words[w] != NULL; w++){
+        if (w > 0 && len + 1 < size){
+            out[len++] = ' ';
+        }
+        for (const char* c = words[w]; *c != 0 && len + 7 < size; c++){
+            unsigned char ch = (unsigned char) *c;
+            if (ch == '"' || ch == '\\'){
+                out[len++] = '\\';
+                out[len++] = (char) ch;
+            } else if (ch < 0x20){
+                len += (size_t) snprintf(out + len, size - len, "\\u%04x", ch);
+            } else {
+                out[len++] = (char) ch;
+            }
+        }
+    }
+    out[len] = 0;
+    return len;
+}
+
+
+#endif //TESTSHELL_TRACE_H
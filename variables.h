@@ -0,0 +1,693 @@
+#ifndef TESTSHELL_VARIABLES_H
+#define TESTSHELL_VARIABLES_H
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+#include "expression.h"
+
+
+extern char** environ;
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define EXPORT_BUILTIN "export"
+#define UNSET_BUILTIN "unset"
+#define VAR_MIN_CAPACITY 64         // slots, a power of two
+#define VAR_OVERLAY_SLOTS 8         // kept free before the environment
+#ifndef FNV_OFFSET
+#define FNV_OFFSET 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+#endif
+
+
+
+
+/* ********************************************************
+ * TYPE DEFINITIONS
+ * ****************************************************** */
+
+
+/**
+ * A shell variable. Its name and value are kept as the "NAME=value"
+ * string the environment of a child needs, so exporting it copies
+ * nothing.
+ * */
+typedef struct Var {
+    char*           entry;      // "NAME=value", NULL for a free slot
+    uint64_t        hash;       // of the name
+    size_t          name_len;
+    bool            exported;
+    bool            deleted;    // unset: lookups must go past the slot
+    uint64_t        changed;    // `changes` of the table when last set
+    size_t          env_index;  // in `envp`, when exported
+} Var;
+
+
+/**
+ * The variables of the shell, in an open-addressing table (linear
+ * probing), filled from `environ` the first time it is used.
+ * The environment of the children is built from it, and kept: a new
+ * value of an exported variable replaces its string in place, and the
+ * array is built again only when a variable is exported or unset, which
+ * bumps `generation`. The `VAR=value` words before a command are laid
+ * over it for the time of the spawn.
+ * */
+typedef struct Var_table {
+    Var*            slots;
+    size_t          capacity;       // power of two, 0 before the import
+    size_t          count;          // variables
+    size_t          used;           // variables and deleted slots
+    uint64_t        changes;        // bumped by every assignment
+    uint64_t        generation;     // bumped when `envp` must be rebuilt
+    char**          env;            // `front` free slots, then `envp`
+    char**          envp;
+    size_t          env_count;
+    size_t          front;
+    uint64_t        env_generation; // of `envp`
+} Var_table;
+
+
+Var_table VARS = {NULL, 0, 0, 0, 0, 0, NULL, NULL, 0, 0, 0};
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+Var*        var_find            (Var_table* table, const char* name,
+                                 size_t len);
+const char* var_get             (Var_table* table, const char* name);
+Var*        var_set             (Var_table* table, const char* name,
+                                 size_t len, const char* value, bool export);
+bool        var_assign          (Var_table* table, const char* word,
+                                 bool export);
+bool        var_unset           (Var_table* table, const char* name,
+                                 size_t len);
+Var*        var_slot            (Var_table* table, const char* name,
+                                 size_t len, uint64_t hash);
+bool        vars_ready          (Var_table* table);
+bool        vars_resize         (Var_table* table, size_t capacity);
+void        vars_free           (Var_table* table);
+char**      var_push            (Var_table* table, char** assign);
+void        var_pop             (Var_table* table, char** saved);
+char**      var_envp            (Var_table* table);
+char**      var_overlay         (Var_table* table, char** assign);
+void        var_overlay_end     (Var_table* table, char** assign);
+Command*    var_command         (Command* cmd);
+char*       var_expand          (Var_table* table, const char* word);
+size_t      var_name_len        (const char* str);
+bool        is_assignment       (const char* word);
+uint64_t    hash_name           (const char* name, size_t len);
+int         export_builtin      (Command* cmd);
+int         unset_builtin       (Command* cmd);
+
+
+
+
+/* ********************************************************
+ * TABLE
+ * ****************************************************** */
+
+
+/**
+ * @return  the variable called `name` (its first `len` characters), or
+ *          NULL if it is not set.
+ * */
+Var* var_find (Var_table* table, const char* name, size_t len){
+    if (!vars_ready(table)){
+        return NULL;
+    }
+    Var* var = var_slot(table, name, len, hash_name(name, len));
+    return var->entry != NULL ? var : NULL;
+}
+
+
+/**
+ * Stands for `getenv()` in the shell, which no longer changes `environ`.
+ * @return  the value of `name`, or NULL if it is not set.
+ * */
+const char* var_get (Var_table* table, const char* name){
+    Var* var = var_find(table, name, strlen(name));
+    return var != NULL ? var->entry + var->name_len + 1 : NULL;
+}
+
+
+/**
+ * Gives a value to a variable, created if needed.
+ * @param   export  true to export it; false keeps it the way it was (a
+ *                  new variable is then not exported).
+ * @return  the variable, or NULL if memory is lacking.
+ * */
+Var* var_set (Var_table* table, const char* name, size_t len,
+              const char* value, bool export){
+    if (!vars_ready(table)){
+        return NULL;
+    }
+    if ((table->used + 1) * 4 > table->capacity * 3
+            && !vars_resize(table, table->count * 2 >= table->capacity
+                                   ? table->capacity * 2 : table->capacity)){
+        return NULL;
+    }
+
+    size_t value_len = strlen(value);
+    char*  entry = malloc(len + value_len + 2);
+    if (entry == NULL){
+        return NULL;
+    }
+    memcpy(entry, name, len);
+    entry[len] = '=';
+    memcpy(entry + len + 1, value, value_len + 1);
+
+    uint64_t hash = hash_name(name, len);
+    Var*     var = var_slot(table, name, len, hash);
+    if (var->entry == NULL){
+        if (!var->deleted){
+            table->used++;
+        }
+        table->count++;
+        var->hash = hash;
+        var->name_len = len;
+        var->exported = false;
+        var->deleted = false;
+    }
+    free(var->entry);
+    var->entry = entry;
+    var->changed = ++table->changes;
+
+    /* Only a new exported variable changes the shape of the environment. */
+    if (export && !var->exported){
+        var->exported = true;
+        table->generation++;
+    } else if (var->exported && table->env_generation == table->generation){
+        table->envp[var->env_index] = entry;
+    }
+    return var;
+}
+
+
+/**
+ * Sets the variable of a "NAME=value" word.
+ * @return  false if memory is lacking.
+ * */
+bool var_assign (Var_table* table, const char* word, bool export){
+    size_t len = strchr(word, '=') - word;
+    return var_set(table, word, len, word + len + 1, export) != NULL;
+}
+
+
+/**
+ * Removes a variable. Its slot is kept as deleted, so that the lookups
+ * of the names that came after it still go through.
+ * @return  false if it was not set.
+ * */
+bool var_unset (Var_table* table, const char* name, size_t len){
+    Var* var = var_find(table, name, len);
+    if (var == NULL){
+        return false;
+    }
+    if (var->exported){
+        table->generation++;
+    }
+    free(var->entry);
+    var->entry = NULL;
+    var->deleted = true;
+    var->changed = ++table->changes;
+    table->count--;
+    return true;
+}
+
+
+/**
+ * Linear probing: the slot of `name`, or else the slot it would get (the
+ * first deleted one met, or the free one that ended the search).
+ * */
+Var* var_slot (Var_table* table, const char* name, size_t len,
+               uint64_t hash){
+    size_t mask = table->capacity - 1;
+    Var*   reuse = NULL;
+    for (size_t i = hash & mask; ; i = (i + 1) & mask){
+        Var* var = &table->slots[i];
+        if (var->entry == NULL && !var->deleted){
+            return reuse != NULL ? reuse : var;
+        }
+        if (var->entry == NULL){
+            if (reuse == NULL) reuse = var;
+        } else if (var->hash == hash && var->name_len == len
+                   && memcmp(var->entry, name, len) == 0){
+            return var;
+        }
+    }
+}
+
+
+/**
+ * Fills the table from `environ` the first time it is used.
+ * @return  false if memory is lacking.
+ * */
+bool vars_ready (Var_table* table){
+    if (table->capacity != 0){
+        return true;
+    }
+    if (!vars_resize(table, VAR_MIN_CAPACITY)){
+        return false;
+    }
+    for (char** env = environ; *env != NULL; env++){
+        const char* equal = strchr(*env, '=');
+        if (equal != NULL && var_set(table, *env, equal - *env, equal + 1,
+                                     true) == NULL){
+            return false;
+        }
+    }
+    table->generation++;  // even with no variable at all
+    return true;
+}
+
+
+/**
+ * Moves the variables to `capacity` slots, which drops the deleted ones.
+ * */
+bool vars_resize (Var_table* table, size_t capacity){
+    Var* slots = calloc(capacity, sizeof(Var));
+    if (slots == NULL){
+        return false;
+    }
+    Var_table old = *table;
+    table->slots = slots;
+    table->capacity = capacity;
+    table->used = table->count;
+    for (size_t i = 0; i < old.capacity; i++){
+        Var* var = &old.slots[i];
+        if (var->entry != NULL){
+            *var_slot(table, var->entry, var->name_len, var->hash) = *var;
+        }
+    }
+    free(old.slots);
+    table->generation++;  // the indexes in `envp` went with the slots
+    return true;
+}
+
+
+/**
+ * Sets the variables of the "NAME=value" words of `assign` for the time
+ * of a builtin. What they were is saved in the LINE_ARENA: a "NAME=value"
+ * word, or the name alone when the variable was not set.
+ * @return  what `var_pop()` needs to put them back, NULL if there is
+ *          nothing to set or memory is lacking.
+ * */
+char** var_push (Var_table* table, char** assign){
+    size_t count = 0;
+    while (assign != NULL && assign[count] != NULL) count++;
+    if (count == 0){
+        return NULL;
+    }
+    char** saved = arena_alloc(&LINE_ARENA, (count + 1) * sizeof(char*));
+    if (saved == NULL){
+        return NULL;
+    }
+    for (size_t i = 0; i < count; i++){
+        size_t len = strchr(assign[i], '=') - assign[i];
+        Var*   var = var_find(table, assign[i], len);
+        char*  old;
+        if (var != NULL){
+            old = arena_strdup(&LINE_ARENA, var->entry);
+        } else if ((old = arena_alloc(&LINE_ARENA, len + 1)) != NULL){
+            memcpy(old, assign[i], len);
+            old[len] = 0;
+        }
+        if (old == NULL || !var_assign(table, assign[i], false)){
+            return NULL;
+        }
+        saved[count - 1 - i] = old;  // put back in reverse order
+    }
+    saved[count] = NULL;
+    return saved;
+}
+
+
+void var_pop (Var_table* table, char** saved){
+    for (; saved != NULL && *saved != NULL; saved++){
+        if (strchr(*saved, '=') != NULL){
+            var_assign(table, *saved, false);
+        } else {
+            var_unset(table, *saved, strlen(*saved));
+        }
+    }
+}
+
+
+void vars_free (Var_table* table){
+    for (size_t i = 0; i < table->capacity; i++){
+        free(table->slots[i].entry);
+    }
+    free(table->slots);
+    free(table->env);
+    memset(table, 0, sizeof(*table));
+}
+
+
+
+
+/* ********************************************************
+ * ENVIRONMENT OF THE CHILDREN
+ * ****************************************************** */
+
+
+/**
+ * @return  the environment of the children, built again only if a
+ *          variable was exported or unset since last time; NULL if
+ *          memory is lacking.
+ * */
+char** var_envp (Var_table* table){
+    if (!vars_ready(table)){
+        return NULL;
+    }
+    if (table->env_generation == table->generation){
+        return table->envp;
+    }
+
+    size_t exported = 0;
+    for (size_t i = 0; i < table->capacity; i++){
+        exported += table->slots[i].entry != NULL
+                    && table->slots[i].exported;
+    }
+    size_t front = table->front > VAR_OVERLAY_SLOTS ? table->front
+                                                    : VAR_OVERLAY_SLOTS;
+    char** env = realloc(table->env, (front + exported + 1) * sizeof(char*));
+    if (env == NULL){
+        return NULL;
+    }
+    table->env = env;
+    table->envp = env + front;
+    table->front = front;
+
+    size_t n = 0;
+    for (size_t i = 0; i < table->capacity; i++){
+        Var* var = &table->slots[i];
+        if (var->entry != NULL && var->exported){
+            var->env_index = n;
+            table->envp[n++] = var->entry;
+        }
+    }
+    table->envp[n] = NULL;
+    table->env_count = n;
+    table->env_generation = table->generation;
+    return table->envp;
+}
+
+
+/**
+ * Lays the "NAME=value" words of `assign` over the environment, without
+ * copying it: an exported variable has its string replaced in place, and
+ * the others take the free slots before the array. The last word of a
+ * name wins. `var_overlay_end()` puts everything back once the child is
+ * spawned.
+ * @return  the environment of the child, NULL if memory is lacking.
+ * */
+char** var_overlay (Var_table* table, char** assign){
+    char** envp = var_envp(table);
+    if (assign == NULL || envp == NULL){
+        return envp;
+    }
+
+    size_t count = 0;
+    while (assign[count] != NULL) count++;
+    if (count > table->front){
+        table->front = count;
+        table->generation++;
+        if ((envp = var_envp(table)) == NULL){
+            return NULL;
+        }
+    }
+
+    for (size_t i = 0; i < count; i++){
+        size_t len = strchr(assign[i], '=') - assign[i];
+        Var*   var = var_find(table, assign[i], len);
+        if (var != NULL && var->exported){
+            table->envp[var->env_index] = assign[i];
+            continue;
+        }
+        char** slot = envp;  // the same name twice takes a single slot
+        while (slot < table->envp && strncmp(*slot, assign[i], len + 1) != 0){
+            slot++;
+        }
+        if (slot == table->envp){
+            slot = --envp;
+        }
+        *slot = assign[i];
+    }
+    return envp;
+}
+
+
+void var_overlay_end (Var_table* table, char** assign){
+    for (; assign != NULL && *assign != NULL; assign++){
+        Var* var = var_find(table, *assign, strchr(*assign, '=') - *assign);
+        if (var != NULL && var->exported){
+            table->envp[var->env_index] = var->entry;
+        }
+    }
+}
+
+
+
+
+/* ********************************************************
+ * EXPANSION
+ * ****************************************************** */
+
+
+/**
+ * Replaces `$NAME` and `${NAME}` by the value of the variable (nothing if
+ * it is not set) in the words and the '>' file of `cmd`, and takes the
+ * "NAME=value" words at its start out to `env`. A value stays a single
+ * word; a word that becomes empty is dropped. The new words are in the
+ * LINE_ARENA, the tree is not modified.
+ * @return  `cmd` itself if there was nothing to do, NULL if memory is
+ *          lacking.
+ * */
+Command* var_command (Command* cmd){
+    int  argc = 0;
+    bool dollar = cmd->redirect_flag && strchr(cmd->output_file, '$');
+    for (; cmd->cmd[argc] != NULL; argc++){
+        dollar |= strchr(cmd->cmd[argc], '$') != NULL;
+    }
+    if (!dollar && (argc == 0 || !is_assignment(cmd->cmd[0]))){
+        return cmd;
+    }
+
+    Command* expanded = arena_alloc(&LINE_ARENA, sizeof(Command));
+    char**   words = arena_alloc(&LINE_ARENA, (argc + 1) * sizeof(char*));
+    if (expanded == NULL || words == NULL){
+        return NULL;
+    }
+    *expanded = *cmd;
+
+    int assign = 0;
+    while (assign < argc && is_assignment(cmd->cmd[assign])) assign++;
+    if (assign > 0){
+        expanded->env = arena_alloc(&LINE_ARENA,
+                                    (assign + 1) * sizeof(char*));
+        if (expanded->env == NULL){
+            return NULL;
+        }
+        for (int i = 0; i < assign; i++){
+            if ((expanded->env[i] = var_expand(&VARS, cmd->cmd[i])) == NULL){
+                return NULL;
+            }
+        }
+        expanded->env[assign] = NULL;
+    }
+
+    int count = 0;
+    for (int i = assign; i < argc; i++){
+        char* word = var_expand(&VARS, cmd->cmd[i]);
+        if (word == NULL){
+            return NULL;
+        }
+        if (*word != 0 || *cmd->cmd[i] == 0){
+            words[count++] = word;
+        }
+    }
+    words[count] = NULL;
+    expanded->cmd = words;
+
+    if (cmd->redirect_flag
+            && (expanded->output_file = var_expand(&VARS, cmd->output_file))
+               == NULL){
+        return NULL;
+    }
+    return expanded;
+}
+
+
+/**
+ * @return  `word` with its variables replaced, `word` itself if it has
+ *          none, NULL if memory is lacking.
+ * */
+char* var_expand (Var_table* table, const char* word){
+    if (strchr(word, '$') == NULL){
+        return (char*) word;
+    }
+
+    /* Measured first, then written, to take the arena only once. */
+    char* result = NULL;
+    char* out = NULL;
+    for (int pass = 0; pass < 2; pass++){
+        size_t size = 0;
+        for (const char* c = word; *c != 0; ){
+            bool   braces = c[0] == '$' && c[1] == '{';
+            size_t len = c[0] == '$' ? var_name_len(c + 1 + braces) : 0;
+            if (len == 0 || (braces && c[2 + len] != '}')){
+                if (out != NULL) *out++ = *c;
+                size++;
+                c++;
+                continue;
+            }
+            Var* var = var_find(table, c + 1 + braces, len);
+            if (var != NULL){
+                const char* value = var->entry + var->name_len + 1;
+                size_t      value_len = strlen(value);
+                if (out != NULL) out = mempcpy(out, value, value_len);
+                size += value_len;
+            }
+            c += 1 + len + 2 * braces;
+        }
+        if (out != NULL){
+            *out = 0;
+        } else if ((result = out = arena_alloc(&LINE_ARENA, size + 1))
+                   == NULL){
+            return NULL;
+        }
+    }
+    return result;
+}
+
+
+/**
+ * @return  the length of the variable name `str` starts with (letters,
+ *          digits and '_', not starting with a digit), 0 if none.
+ * */
+size_t var_name_len (const char* str){
+    size_t len = 0;
+    while ((str[len] >= 'a' && str[len] <= 'z')
+           || (str[len] >= 'A' && str[len] <= 'Z') || str[len] == '_'
+           || (len > 0 && str[len] >= '0' && str[len] <= '9')){
+        len++;
+    }
+    return len;
+}
+
+
+/**
+ * @return  true if `word` is a "NAME=value" assignment.
+ * */
+bool is_assignment (const char* word){
+    size_t len = var_name_len(word);
+    return len > 0 && word[len] == '=';
+}
+
+
+/**
+ * FNV-1a hash of the first `len` characters of `name`.
+ * */
+uint64_t hash_name (const char* name, size_t len){
+    uint64_t hash = FNV_OFFSET;
+    for (size_t i = 0; i < len; i++){
+        hash = (hash ^ (unsigned char) name[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+
+
+
+/* ********************************************************
+ * BUILTINS
+ * ****************************************************** */
+
+
+/**
+ * `export`                 lists the exported variables, sorted.
+ * `export NAME=value...`   sets the variables and exports them.
+ * `export NAME...`         exports variables that are already set.
+ * @return  false if a name is not valid.
+ * */
+int export_builtin (Command* cmd){
+    char** args = cmd->cmd;
+
+    if (args[1] == NULL){
+        char** envp = var_envp(&VARS);
+        if (envp == NULL){
+            perror("export");
+            return false;
+        }
+        char** sorted = arena_alloc(&LINE_ARENA,
+                                    (VARS.env_count + 1) * sizeof(char*));
+        if (sorted == NULL){
+            perror("export");
+            return false;
+        }
+        memcpy(sorted, envp, VARS.env_count * sizeof(char*));
+        qsort(sorted, VARS.env_count, sizeof(char*), compare_strings);
+        for (size_t i = 0; i < VARS.env_count; i++){
+            printf("export %s\n", sorted[i]);
+        }
+        return true;
+    }
+
+    int success = true;
+    for (int i = 1; args[i] != NULL; i++){
+        size_t len = var_name_len(args[i]);
+        if (len == 0 || (args[i][len] != '=' && args[i][len] != 0)){
+            fprintf(stderr, "export: `%s': not a valid identifier\n",
+                    args[i]);
+            success = false;
+            continue;
+        }
+        Var* var = var_find(&VARS, args[i], len);
+        bool set = args[i][len] == '='
+                 ? var_assign(&VARS, args[i], true)
+                 : var == NULL || var_set(&VARS, args[i], len,
+                                var->entry + len + 1, true) != NULL;
+        if (!set){
+            perror("export");
+            success = false;
+        }
+    }
+    return success;
+}
+
+
+/**
+ * `unset NAME...` removes the variables.
+ * */
+int unset_builtin (Command* cmd){
+    int success = true;
+    for (char** arg = cmd->cmd + 1; *arg != NULL; arg++){
+        size_t len = var_name_len(*arg);
+        if (len == 0 || (*arg)[len] != 0){
+            fprintf(stderr, "unset: `%s': not a valid identifier\n", *arg);
+            success = false;
+            continue;
+        }
+        var_unset(&VARS, *arg, len);
+    }
+    return success;
+}
+
+
+#endif //TESTSHELL_VARIABLES_H
@@ -0,0 +1,145 @@
+#ifndef TESTSHELL_XARGS_H
+#define TESTSHELL_XARGS_H
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+
+
+/* ********************************************************
+ * GLOBAL DEFINITIONS
+ * ****************************************************** */
+
+
+#define XARGS_ENV_VAR "SHELL_XARGS"
+#define XARGS_HEADROOM 2048         // left free under ARG_MAX, like xargs
+#define XARGS_SEPARATOR "--"
+
+
+/**
+ * Set by `--xargs`: a command whose arguments do not fit in one exec is
+ * run in batches instead of failing with E2BIG.
+ * */
+bool XARGS = false;
+
+
+
+
+/* ********************************************************
+ * FUNCTION DECLARATIONS
+ * ****************************************************** */
+
+
+size_t xargs_word_size   (const char* word);
+size_t xargs_room        (Command* cmd);
+bool   xargs_needed      (Command* cmd);
+const char* xargs_hint   (Command* cmd);
+int    xargs_fixed       (char** words);
+int    xargs_batch_end   (char** words, int from, size_t room);
+
+
+
+
+/* ********************************************************
+ * BATCHES
+ * ****************************************************** */
+
+
+/**
+ * @return  what a word costs to the kernel: the string and its pointer.
+ * */
+size_t xargs_word_size (const char* word){
+    return strlen(word) + 1 + sizeof(char*);
+}
+
+
+/**
+ * @return  the room the kernel leaves to the words of a command: ARG_MAX,
+ *          less the environment (which it counts too, with the
+ *          assignments before the command) and the headroom.
+ * */
+size_t xargs_room (Command* cmd){
+    long   max = sysconf(_SC_ARG_MAX);
+    size_t used = XARGS_HEADROOM + 2 * sizeof(char*);  // the two NULLs
+    char** envp = var_envp(&VARS);
+    for (char** env = envp; env != NULL && *env != NULL; env++){
+        used += xargs_word_size(*env);
+    }
+    for (char** env = cmd->env; env != NULL && *env != NULL; env++){
+        used += xargs_word_size(*env);
+    }
+    return max > 0 && (size_t) max > used ? (size_t) max - used : 0;
+}
+
+
+/**
+ * @return  true if `cmd` is too long for one exec, `--xargs` is on and the
+ *          words every batch starts with are marked (see `xargs_fixed()`).
+ * */
+bool xargs_needed (Command* cmd){
+    if (!XARGS || xargs_fixed(cmd->cmd) == 0){
+        return false;
+    }
+    size_t size = 0;
+    for (char** word = cmd->cmd; *word != NULL; word++){
+        size += xargs_word_size(*word);
+    }
+    return size > xargs_room(cmd);
+}
+
+
+/**
+ * @return  what to add to the error of a command too long for one exec:
+ *          how to have it run in batches, or "" if that would not help.
+ * */
+const char* xargs_hint (Command* cmd){
+    if (!XARGS){
+        return " (see --xargs)";
+    }
+    return xargs_fixed(cmd->cmd) == 0 ? " (mark the fixed words with --)" : "";
+}
+
+
+/**
+ * Tells which words every batch starts with, the way xargs is given its
+ * command: everything up to the first "--" (as in `grep -l word -- FILES`).
+ * There is no guessing them otherwise, `grep PATTERN FILES` or
+ * `cp FILES DIR` would be split in the wrong place.
+ * @return  the number of these words, or 0 if there is no "--".
+ * */
+int xargs_fixed (char** words){
+    for (int i = 1; words[i] != NULL; i++){
+        if (strcmp(words[i], XARGS_SEPARATOR) == 0){
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+
+/**
+ * Fills the batch that starts at `from` with as many words as fit in
+ * `room`, which is what is left once the fixed words are counted. Filling
+ * every batch up gives the fewest batches. A word that fits in none still
+ * gets a batch of its own, to fail like it would without `--xargs`.
+ * @return  the index after the last word of the batch.
+ * */
+int xargs_batch_end (char** words, int from, size_t room){
+    size_t used = 0;
+    int    end = from;
+    while (words[end] != NULL){
+        size_t size = xargs_word_size(words[end]);
+        if (end > from && used + size > room){
+            break;
+        }
+        used += size;
+        end++;
+    }
+    return end;
+}
+
+
+#endif //TESTSHELL_XARGS_H